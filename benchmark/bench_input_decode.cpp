@@ -0,0 +1,120 @@
+/************************************************************************
+*
+* Copyright (C) 2014-2020 Barbara Geller & Ansel Sermersheim
+* Copyright (C) 1997-2014 by Dimitri van Heesch
+*
+* DoxyPress is free software: you can redistribute it and/or
+* modify it under the terms of the GNU General Public License version 2
+* as published by the Free Software Foundation.
+*
+* DoxyPress is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+*
+* Documents produced by DoxyPress are derivative works derived from the
+* input used in their production; they are not affected by this license.
+*
+*************************************************************************/
+
+// Times the ASCII scan and the two paths decodeInputBuffer() takes for an input file,
+// QString::fromUtf8() for ASCII input and the configured codec otherwise
+//
+// usage: bench_input_decode [directory] [codec]
+//    directory defaults to test_build in the source tree, codec defaults to ISO-8859-1
+
+#include <QByteArray>
+#include <QDirIterator>
+#include <QFile>
+#include <QString>
+#include <QTextCodec>
+#include <QVector>
+
+#include <asciiscan.h>
+
+#include <chrono>
+#include <stdio.h>
+
+// each measurement is repeated until this many bytes were processed
+static const qint64 minBytes = qint64(1) << 30;
+
+template <typename F>
+static void measure(const char *name, const QVector<QByteArray> &files, qint64 totalSize, F func)
+{
+   auto start  = std::chrono::steady_clock::now();
+   qint64 done = 0;
+   size_t sink = 0;
+
+   while (done < minBytes) {
+      for (const auto &data : files) {
+         sink += func(data);
+      }
+
+      done += totalSize;
+   }
+
+   std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+   printf("%-24s %8.2f GB/s   (%zu)\n", name, done / elapsed.count() / 1e9, sink);
+}
+
+int main(int argc, char *argv[])
+{
+   QString dirName   = argc > 1 ? QString::fromUtf8(argv[1]) : QString::fromUtf8(TEST_BUILD_DIR);
+   QString codecName = argc > 2 ? QString::fromUtf8(argv[2]) : QString("ISO-8859-1");
+
+   QTextCodec *codec = QTextCodec::codecForName(codecName.toUtf8());
+
+   if (codec == nullptr) {
+      fprintf(stderr, "Unsupported character encoding: '%s'\n", argv[2]);
+      return 1;
+   }
+
+   QVector<QByteArray> files;
+   qint64 totalSize = 0;
+   int asciiFiles   = 0;
+
+   QDirIterator iter(dirName, QDir::Files, QDirIterator::Subdirectories);
+
+   while (iter.hasNext()) {
+      QFile f(iter.next());
+
+      if (! f.open(QIODevice::ReadOnly)) {
+         continue;
+      }
+
+      QByteArray data = f.readAll();
+
+      if (isAsciiBuffer(data.constData(), data.size())) {
+         ++asciiFiles;
+      }
+
+      totalSize += data.size();
+      files.append(data);
+   }
+
+   if (totalSize == 0) {
+      fprintf(stderr, "No input files found in %s\n", dirName.toUtf8().constData());
+      return 1;
+   }
+
+   printf("%d files, %d ASCII only, %lld bytes\n\n", static_cast<int>(files.size()), asciiFiles,
+         static_cast<long long>(totalSize));
+
+   measure("isAsciiBuffer", files, totalSize, [] (const QByteArray &data) {
+      return size_t(isAsciiBuffer(data.constData(), data.size()));
+   });
+
+   measure("scan + fromUtf8", files, totalSize, [codec] (const QByteArray &data) {
+      if (isAsciiBuffer(data.constData(), data.size())) {
+         return size_t(QString::fromUtf8(data.constData(), data.size()).size_storage());
+      }
+
+      return size_t(codec->toUnicode(data).size_storage());
+   });
+
+   measure("codec toUnicode", files, totalSize, [codec] (const QByteArray &data) {
+      return size_t(codec->toUnicode(data).size_storage());
+   });
+
+   return 0;
+}
@@ -61,6 +61,7 @@ struct Argument {
    QString attrib;             /*!< Argument's attribute (IDL only) */
    QString type;               /*!< Argument's type */
    mutable QString canType;    /*!< Cached value of canonical type (after type resolution). Empty initially. */
+   mutable QString canTypeKey; /*!< Cached canonical type with all spaces removed, used for comparing */
    QString name;               /*!< Argument's name (may be empty) */
    QString array;              /*!< Argument's array specifier (may be empty) */
    QString defval;             /*!< Argument's default value (may be empty) */
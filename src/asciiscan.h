@@ -0,0 +1,72 @@
+/************************************************************************
+*
+* Copyright (C) 2014-2020 Barbara Geller & Ansel Sermersheim
+* Copyright (C) 1997-2014 by Dimitri van Heesch
+*
+* DoxyPress is free software: you can redistribute it and/or
+* modify it under the terms of the GNU General Public License version 2
+* as published by the Free Software Foundation.
+*
+* DoxyPress is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+*
+* Documents produced by DoxyPress are derivative works derived from the
+* input used in their production; they are not affected by this license.
+*
+*************************************************************************/
+
+#ifndef ASCIISCAN_H
+#define ASCIISCAN_H
+
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+// true if no byte has the high bit set, checks 16 or 32 bytes at a time when the compiler targets SSE2 or AVX2
+inline bool isAsciiBuffer(const char *data, int size)
+{
+   int i = 0;
+
+#if defined(__AVX2__)
+   for ( ; i + 32 <= size; i += 32) {
+      __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + i));
+
+      if (_mm256_movemask_epi8(chunk) != 0) {
+         return false;
+      }
+   }
+
+#elif defined(__SSE2__)
+   for ( ; i + 16 <= size; i += 16) {
+      __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i));
+
+      if (_mm_movemask_epi8(chunk) != 0) {
+         return false;
+      }
+   }
+
+#endif
+
+   for ( ; i + 8 <= size; i += 8) {
+      uint64_t chunk;
+      memcpy(&chunk, data + i, 8);
+
+      if ((chunk & 0x8080808080808080ULL) != 0) {
+         return false;
+      }
+   }
+
+   for ( ; i < size; ++i) {
+      if (static_cast<unsigned char>(data[i]) & 0x80) {
+         return false;
+      }
+   }
+
+   return true;
+}
+
+#endif
@@ -1684,12 +1684,12 @@ void ClassDef::writeDeclarationLink(OutputList &ol, bool &found, const QString &
       // add the brief description if available
       if (! brief.isEmpty() && briefMemberDesc) {
 
-         DocRoot *rootNode = validatingParseDoc(briefFile(), briefLine(), self, QSharedPointer<MemberDef>(),
-                                                brief, false, false, "", true, false);
+         QSharedPointer<DocRoot> rootNode = sharedParseDoc(briefFile(), briefLine(), self, QSharedPointer<MemberDef>(),
+                                                          brief, false, false, "", true, false);
 
          if (rootNode && ! rootNode->isEmpty()) {
             ol.startMemberDescription(anchor());
-            ol.writeDoc(rootNode, self, QSharedPointer<MemberDef>());
+            ol.writeDoc(rootNode.data(), self, QSharedPointer<MemberDef>());
 
             if (isLinkableInProject()) {
                writeMoreLink(ol, anchor());
@@ -1697,7 +1697,6 @@ void ClassDef::writeDeclarationLink(OutputList &ol, bool &found, const QString &
 
             ol.endMemberDescription();
          }
-         delete rootNode;
       }
 
       ol.endMemberDeclaration(anchor(), 0);
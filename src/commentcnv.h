@@ -19,7 +19,7 @@
 #ifndef COMMENTCNV_H
 #define COMMENTCNV_H
 
-extern QString convertCppComments(const QString &inBuf, const QString &fileName);
+extern QString convertCppComments(QString inBuf, const QString &fileName);
 
 #endif
 
@@ -141,6 +141,7 @@ void Config::load_Defaults()
 
    m_cfgInt.insert("tab-size",                   struc_CfgInt    { 4,              DEFAULT } );
    m_cfgInt.insert("lookup-cache-size",          struc_CfgInt    { 0,              DEFAULT } );
+   m_cfgInt.insert("doc-cache-size",             struc_CfgInt    { 64,             DEFAULT } );
 
    // tab 2 - build configuration
    m_cfgBool.insert("extract-all",               struc_CfgBool   { false,          DEFAULT } );
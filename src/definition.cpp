@@ -66,10 +66,10 @@ class Definition_Private
    QString briefSignatures;
    QString docSignatures;
 
-   QString localName;         // local (unqualified) name of the definition
+   PoolString localName;      // local (unqualified) name of the definition
 
-   QString qualifiedName;
-   QString ref;               // reference to external documentation
+   PoolString qualifiedName;
+   PoolString ref;            // reference to external documentation
 
    bool hidden;
    bool isArtificial;
@@ -77,8 +77,8 @@ class Definition_Private
    QSharedPointer<Definition> outerScope;
 
    // where the item was found
-   QString defFileName;
-   QString defFileExt;
+   PoolString defFileName;
+   PoolString defFileExt;
 
    SrcLangExt lang;
 
@@ -99,10 +99,10 @@ Definition_Private::~Definition_Private()
 void Definition_Private::init(const QString &df, const QString &n)
 {
    defFileName = df;
-   int lastDot = defFileName.lastIndexOf('.');
+   int lastDot = df.lastIndexOf('.');
 
    if (lastDot != -1) {
-      defFileExt = defFileName.mid(lastDot);
+      defFileExt = df.mid(lastDot);
    }
 
    QString name = n;
@@ -471,11 +471,11 @@ void Definition::setDocumentation(const QString &tDoc, const QString &docFile, i
 
       } else if (atTop) {
          // another detailed description, append it to the start
-         m_private->m_details.doc = doc + "\n\n" + m_private->m_details.doc;
+         m_private->m_details.doc = doc + "\n\n" + m_private->m_details.doc.text();
 
       } else {
          // another detailed description, append it to the end
-         m_private->m_details.doc += "\n\n" + doc;
+         m_private->m_details.doc = m_private->m_details.doc.text() + "\n\n" + doc;
 
       }
 
@@ -556,7 +556,7 @@ void Definition::_setInbodyDocumentation(const QString &doc, const QString &inbo
 
    } else {
       // another inbody documentation fragment, append this to the end
-      m_private->m_inbodyDocs.doc += "\n\n" + doc;
+      m_private->m_inbodyDocs.doc = m_private->m_inbodyDocs.doc.text() + "\n\n" + doc;
    }
 }
 
@@ -1245,7 +1245,7 @@ QString Definition::qualifiedName() const
    }
 
    if (! m_private->outerScope) {
-      if (m_private->localName == "<globalScope>") {
+      if (m_private->localName.str() == "<globalScope>") {
          return QString("");
 
       } else {
@@ -1257,7 +1257,8 @@ QString Definition::qualifiedName() const
       m_private->qualifiedName = m_private->localName;
 
    } else {
-      m_private->qualifiedName = m_private->outerScope->qualifiedName() + getLanguageSpecificSeparator(getLanguage()) + m_private->localName;
+      m_private->qualifiedName = m_private->outerScope->qualifiedName() + getLanguageSpecificSeparator(getLanguage()) +
+                  m_private->localName.str();
    }
 
    return m_private->qualifiedName;
@@ -1275,7 +1276,7 @@ void Definition::setOuterScope(QSharedPointer<Definition> d)
    }
 
    if (! found) {
-      m_private->qualifiedName.resize(0); // flush cached scope name
+      m_private->qualifiedName = QString(); // flush cached scope name
       m_private->outerScope = d;
    }
 
@@ -1360,7 +1361,7 @@ QString Definition::pathFragment() const
       result += pathFragment_Internal();
 
    } else {
-      result += m_private->localName;
+      result += m_private->localName.str();
    }
 
    return result;
@@ -1638,7 +1639,7 @@ QString Definition::phraseName() const
 
 QString Definition::documentation() const
 {
-   return m_private->m_details.doc;
+   return m_private->m_details.doc.text();
 }
 
 int Definition::docLine() const
@@ -1651,7 +1652,7 @@ QString Definition::docFile() const
    QString retval = m_private->m_details.file;
 
    if (retval.isEmpty() ) {
-      retval = "<" + m_name + ">";
+      retval = "<" + m_name.str() + ">";
    }
 
    return retval;
@@ -1710,10 +1711,10 @@ QString Definition::briefDescription(bool doAbbreviate) const
    if (! m_private->m_brief.doc.isEmpty())  {
 
       if (doAbbreviate) {
-         retval = abbreviate(m_private->m_brief.doc, displayName());
+         retval = abbreviate(m_private->m_brief.doc.text(), displayName());
 
       } else {
-         retval = m_private->m_brief.doc;
+         retval = m_private->m_brief.doc.text();
 
       }
    }
@@ -1750,7 +1751,7 @@ QString Definition::briefDescriptionAsTooltip() const
          // prevent requests for tooltips while parsing a tooltip
          reentering = true;
 
-         m_private->m_brief.tooltip = parseCommentAsText(scope, md, m_private->m_brief.doc,
+         m_private->m_brief.tooltip = parseCommentAsText(scope, md, m_private->m_brief.doc.text(),
                m_private->m_brief.file, m_private->m_brief.line);
 
          reentering = false;
@@ -1770,7 +1771,7 @@ QString Definition::briefFile() const
    QString retval = m_private->m_brief.file;
 
    if (retval.isEmpty() ) {
-      retval = "<" + m_name + ">";
+      retval = "<" + m_name.str() + ">";
    }
 
    return retval;
@@ -1778,7 +1779,7 @@ QString Definition::briefFile() const
 
 QString Definition::inbodyDocumentation() const
 {
-   return m_private->m_inbodyDocs.doc;
+   return m_private->m_inbodyDocs.doc.text();
 }
 
 int Definition::inbodyLine() const
@@ -1791,7 +1792,7 @@ QString Definition::inbodyFile() const
    QString retval = m_private->m_inbodyDocs.file;
 
    if (retval.isEmpty() ) {
-      retval = "<" + m_name + ">";
+      retval = "<" + m_name.str() + ">";
    }
 
    return retval;
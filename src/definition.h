@@ -24,9 +24,11 @@
 #include <QTextStream>
 #include <QVector>
 
+#include <docstore.h>
 #include <doxy_shared.h>
 #include <sortedlist.h>
 #include <stringmap.h>
+#include <stringpool.h>
 #include <types.h>
 
 class Definition_Private;
@@ -45,7 +47,7 @@ struct DocInfo {
    DocInfo() : line(1) {};
 
    int line;
-   QString doc;
+   SpillText doc;
    QString file;
 };
 
@@ -55,7 +57,7 @@ struct BriefInfo {
    BriefInfo() : line(1) {};
 
    int line;
-   QString doc;
+   SpillText doc;
    QString tooltip;
    QString file;
 };
@@ -103,6 +105,11 @@ class Definition : public DefinitionIntf
       return m_name;
    }
 
+   // Returns true if both definitions have the same name, names are pooled so this compares two pointers
+   bool hasSameName(const Definition &other) const {
+      return m_name == other.m_name;
+   }
+
    // Returns the name of the definition as it appears in the output
    virtual QString displayName(bool includeScope = true) const = 0;
 
@@ -381,7 +388,7 @@ class Definition : public DefinitionIntf
    bool _docsAlreadyAdded(const QString &doc, QString &sigList);
 
    Definition_Private *m_private;
-   QString m_name;
+   PoolString m_name;
 
    // concepts
    QString m_requires;
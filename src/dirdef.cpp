@@ -168,8 +168,8 @@ void DirDef::writeBriefDescription(OutputList &ol)
    QSharedPointer<DirDef> self = sharedFrom(this);
 
    if (hasBriefDescription())  {
-      DocRoot *rootNode = validatingParseDoc(briefFile(), briefLine(), self, QSharedPointer<MemberDef>(),
-                                             briefDescription(), true, false);
+      QSharedPointer<DocRoot> rootNode = sharedParseDoc(briefFile(), briefLine(), self, QSharedPointer<MemberDef>(),
+                                                       briefDescription(), true, false);
 
       if (rootNode && ! rootNode->isEmpty()) {
          ol.startParagraph();
@@ -179,7 +179,7 @@ void DirDef::writeBriefDescription(OutputList &ol)
          ol.writeString(" - ");
          ol.popGeneratorState();
 
-         ol.writeDoc(rootNode, self, QSharedPointer<MemberDef>());
+         ol.writeDoc(rootNode.data(), self, QSharedPointer<MemberDef>());
          ol.pushGeneratorState();
          ol.disable(OutputGenerator::RTF);
          ol.writeString(" \n");
@@ -195,8 +195,6 @@ void DirDef::writeBriefDescription(OutputList &ol)
 
          ol.endParagraph();
       }
-
-      delete rootNode;
    }
 
    ol.writeSynopsis();
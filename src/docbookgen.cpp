@@ -340,7 +340,7 @@ static void writeDocbookDocBlock(QTextStream &t, const QString &fileName, int li
    }
 
    // convert the documentation string into an abstract syntax tree
-   DocNode *root = validatingParseDoc(fileName, lineNr, scope, md, text, false, false);
+   QSharedPointer<DocRoot> root = sharedParseDoc(fileName, lineNr, scope, md, text, false, false);
 
    // create a code generator
    DocbookCodeGenerator *docbookCodeGen = new DocbookCodeGenerator(t);
@@ -354,7 +354,6 @@ static void writeDocbookDocBlock(QTextStream &t, const QString &fileName, int li
    // clean up
    delete visitor;
    delete docbookCodeGen;
-   delete root;
 }
 
 void writeDocbookCodeBlock(QTextStream &t, QSharedPointer<FileDef> fd)
@@ -0,0 +1,129 @@
+/************************************************************************
+*
+* Copyright (C) 2014-2020 Barbara Geller & Ansel Sermersheim
+* Copyright (C) 1997-2014 by Dimitri van Heesch
+*
+* DoxyPress is free software: you can redistribute it and/or
+* modify it under the terms of the GNU General Public License version 2
+* as published by the Free Software Foundation.
+*
+* DoxyPress is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+*
+* Documents produced by DoxyPress are derivative works derived from the
+* input used in their production; they are not affected by this license.
+*
+*************************************************************************/
+
+#include <memory>
+#include <new>
+#include <vector>
+
+#include <docnodepool.h>
+
+#include <message.h>
+
+namespace {
+
+constexpr size_t slotSize      = 16;             // multiple of the alignment of operator new
+constexpr size_t maxPooledSize = 512;            // larger nodes use the general heap
+constexpr size_t chunkSize     = 64 * 1024;
+
+constexpr size_t slotClasses   = maxPooledSize / slotSize;
+
+struct FreeSlot {
+   FreeSlot *next;
+};
+
+struct Pool {
+   FreeSlot *freeList[slotClasses] = { };
+
+   std::vector<std::unique_ptr<char[]>> chunks;
+
+   char  *current   = nullptr;
+   size_t remaining = 0;
+
+   long long allocated = 0;
+   long long live      = 0;
+   long long peak      = 0;
+};
+
+Pool &pool()
+{
+   // never destroyed, nodes may still be released during static destruction
+   static Pool *retval = new Pool;
+   return *retval;
+}
+
+}
+
+void *DocNodePool::allocate(size_t size)
+{
+   if (size == 0 || size > maxPooledSize) {
+      return ::operator new(size);
+   }
+
+   Pool &p = pool();
+   const size_t index = (size - 1) / slotSize;
+
+   ++p.allocated;
+   ++p.live;
+
+   if (p.live > p.peak) {
+      p.peak = p.live;
+   }
+
+   FreeSlot *slot = p.freeList[index];
+
+   if (slot != nullptr) {
+      p.freeList[index] = slot->next;
+      return slot;
+   }
+
+   const size_t bytes = (index + 1) * slotSize;
+
+   if (p.remaining < bytes) {
+      // remainder of the previous chunk is not used
+      p.chunks.emplace_back(new char[chunkSize]);
+
+      p.current   = p.chunks.back().get();
+      p.remaining = chunkSize;
+   }
+
+   void *retval = p.current;
+
+   p.current   += bytes;
+   p.remaining -= bytes;
+
+   return retval;
+}
+
+void DocNodePool::release(void *ptr, size_t size)
+{
+   if (ptr == nullptr) {
+      return;
+   }
+
+   if (size == 0 || size > maxPooledSize) {
+      ::operator delete(ptr);
+      return;
+   }
+
+   Pool &p = pool();
+   const size_t index = (size - 1) / slotSize;
+
+   FreeSlot *slot = static_cast<FreeSlot *>(ptr);
+   slot->next = p.freeList[index];
+   p.freeList[index] = slot;
+
+   --p.live;
+}
+
+void DocNodePool::printStats()
+{
+   Pool &p = pool();
+
+   msg("Documentation node pool: %lld nodes allocated, %lld at most alive, %lld bytes reserved\n",
+         p.allocated, p.peak, static_cast<long long>(p.chunks.size() * chunkSize));
+}
@@ -0,0 +1,44 @@
+/************************************************************************
+*
+* Copyright (C) 2014-2020 Barbara Geller & Ansel Sermersheim
+* Copyright (C) 1997-2014 by Dimitri van Heesch
+*
+* DoxyPress is free software: you can redistribute it and/or
+* modify it under the terms of the GNU General Public License version 2
+* as published by the Free Software Foundation.
+*
+* DoxyPress is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+*
+* Documents produced by DoxyPress are derivative works derived from the
+* input used in their production; they are not affected by this license.
+*
+*************************************************************************/
+
+#ifndef DOCNODEPOOL_H
+#define DOCNODEPOOL_H
+
+#include <stddef.h>
+
+/** @brief Allocator for the nodes of a parsed documentation block
+ *
+ *  Each documentation block is parsed into a tree of many small DocNode objects which is
+ *  discarded once the output is written. Nodes are carved out of large chunks and released
+ *  nodes are kept on a free list per size, so the next block reuses the same memory
+ *  instead of going through the general heap. Documentation is only parsed on the main thread.
+ */
+class DocNodePool
+{
+ public:
+   /*! Returns memory for a node of \a size bytes */
+   static void *allocate(size_t size);
+
+   /*! Returns the memory of a node of \a size bytes to the pool */
+   static void release(void *ptr, size_t size);
+
+   /*! Print the number of nodes and bytes used by the pool */
+   static void printStats();
+};
+
+#endif
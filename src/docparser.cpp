@@ -16,6 +16,7 @@
 *
 *************************************************************************/
 
+#include <QCache>
 #include <QFile>
 #include <QFileInfo>
 #include <QStack>
@@ -1218,7 +1219,15 @@ static void handleLinkedWord(DocNode *parent, QList<DocNode *> &children, bool i
       // added 01/2016
       tName = renameNS_Aliases(tName, false);
 
-      if (resolveRef(s_context, tName, s_inSeeBlock, &compound, &member, false, fd, true)) {
+      // words which did not resolve before in the same context are not looked up again, resolveRef()
+      // only sees the name of the context so the name is the identity here
+      QString unresolvedKey = "#" + s_context + "+" + (fd ? fd->getFilePath() : QString()) + "+" +
+                  (s_inSeeBlock ? "S+" : "+") + tName;
+
+      if (Doxy_Globals::unresolvedLinkCache.object(unresolvedKey) != nullptr) {
+         // not linkable
+
+      } else if (resolveRef(s_context, tName, s_inSeeBlock, &compound, &member, false, fd, true)) {
          partA = true;
 
       } else if ( ! s_context.isEmpty() )  {
@@ -1228,6 +1237,10 @@ static void handleLinkedWord(DocNode *parent, QList<DocNode *> &children, bool i
             partA = true;
          }
       }
+
+      if (! partA) {
+         Doxy_Globals::unresolvedLinkCache.insert(unresolvedKey, new bool(true));
+      }
    }
 
    if (partA) {
@@ -8818,6 +8831,92 @@ DocRoot *validatingParseDoc(const QString &fileName, int startLine, QSharedPoint
    return root;
 }
 
+struct SharedParseDocData {
+   SharedParseDocData()
+      : cache(qMax(0, Config::getInt("doc-cache-size")) * 1024), hits(0), misses(0)
+   { }
+
+   // cost is counted in KB, the option is in MB
+   QCache<QString, QSharedPointer<DocRoot>> cache;
+
+   int hits;
+   int misses;
+};
+
+static SharedParseDocData &sharedParseDocData()
+{
+   static SharedParseDocData retval;
+   return retval;
+}
+
+QSharedPointer<DocRoot> sharedParseDoc(const QString &fileName, int startLine, QSharedPointer<Definition> ctx,
+                  QSharedPointer<MemberDef> md, const QString &input, bool indexWords, bool isExample,
+                  const QString &exampleName, bool singleLine, bool linkFromIndex)
+{
+   static const bool inlineGroupedClasses = Config::getBool("inline-grouped-classes");
+   static const bool inlineSimpleClasses  = Config::getBool("inline-simple-struct");
+
+   SharedParseDocData &data = sharedParseDocData();
+
+   if (data.cache.maxCost() == 0) {
+      return QSharedPointer<DocRoot>(validatingParseDoc(fileName, startLine, ctx, md, input, indexWords,
+                  isExample, exampleName, singleLine, linkFromIndex));
+   }
+
+   // links to embedded classes only differ in the XML output when classes are inlined
+   bool xmlLinks = Doxy_Globals::generatingXmlOutput && (inlineGroupedClasses || inlineSimpleClasses);
+
+   QString key = fileName + "\n" + QString::number(startLine) + "\n" +
+                  QString::number(reinterpret_cast<quintptr>(ctx.data()), 16) + "\n" +
+                  QString::number(reinterpret_cast<quintptr>(md.data()), 16) + "\n" +
+                  (isExample ? "1" : "0") + (singleLine ? "1" : "0") + (linkFromIndex ? "1" : "0") +
+                  (xmlLinks ? "1" : "0") + exampleName + "\n" + input;
+
+   if (! indexWords) {
+      // a tree parsed with indexWords set is the same, only the search index is updated
+      QSharedPointer<DocRoot> *cached = data.cache.object(key);
+
+      if (cached != nullptr) {
+         ++data.hits;
+         return *cached;
+      }
+   }
+
+   ++data.misses;
+
+   QSharedPointer<DocRoot> root(validatingParseDoc(fileName, startLine, ctx, md, input, indexWords,
+                  isExample, exampleName, singleLine, linkFromIndex));
+
+   // the key holds a copy of the input, the tree is estimated at a node per few characters of input
+   int cost = static_cast<int>((key.size_storage() + input.size_storage() * 16) / 1024) + 1;
+
+   // each output pass walks the definitions in the same order, evicting the oldest trees to make room
+   // would remove the trees the next pass asks for first, so entries are only added while there is room
+   if (data.cache.contains(key) || data.cache.totalCost() + cost <= data.cache.maxCost()) {
+      data.cache.insert(key, new QSharedPointer<DocRoot>(root), cost);
+   }
+
+   return root;
+}
+
+void clearSharedParseDocCache()
+{
+   sharedParseDocData().cache.clear();
+}
+
+void printSharedParseDocStats()
+{
+   SharedParseDocData &data = sharedParseDocData();
+
+   if (data.cache.maxCost() == 0) {
+      return;
+   }
+
+   msg("Parsed documentation cache: %d trees, %d KB used, cache hits %d, misses %d, hit ratio %.1f%%\n",
+         data.cache.count(), data.cache.totalCost(), data.hits, data.misses,
+         (data.hits + data.misses) > 0 ? data.hits * 100.0 / (data.hits + data.misses) : 0.0);
+}
+
 DocText *validatingParseText(const QString &input)
 {
    // store parser state so we can re-enter this function if needed
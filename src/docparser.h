@@ -24,6 +24,7 @@
 #include <stdio.h>
 
 #include <definition.h>
+#include <docnodepool.h>
 #include <docvisitor.h>
 #include <htmlattrib.h>
 #include <membergroup.h>
@@ -74,6 +75,20 @@ DocRoot *validatingParseDoc(const QString &fileName, int startLine, QSharedPoint
                   QSharedPointer<MemberDef> md, const QString &input, bool indexWords, bool isExample,
                   const QString &exampleName = QString(), bool singleLine = false, bool linkFromIndex = false);
 
+/*! Same as validatingParseDoc() but the tree may be shared. Blocks parsed again with the same
+ *  arguments, for example by another output format, reuse the tree from a cache whose size is
+ *  set by the doc-cache-size option. The tree must not be modified by the caller.
+ */
+QSharedPointer<DocRoot> sharedParseDoc(const QString &fileName, int startLine, QSharedPointer<Definition> context,
+                  QSharedPointer<MemberDef> md, const QString &input, bool indexWords, bool isExample,
+                  const QString &exampleName = QString(), bool singleLine = false, bool linkFromIndex = false);
+
+/*! Releases the trees held by sharedParseDoc() */
+void clearSharedParseDocCache();
+
+/*! Print the hit and miss counts of the sharedParseDoc() cache */
+void printSharedParseDocStats();
+
 /*! Main entry point for parsing simple text fragments. These
  *  fragments are limited to words, whitespace and symbols.
  */
@@ -150,6 +165,15 @@ class DocNode
    /*! Destroys a node. */
    virtual ~DocNode() {}
 
+   /*! Nodes are allocated from the DocNodePool */
+   static void *operator new(size_t size) {
+      return DocNodePool::allocate(size);
+   }
+
+   static void operator delete(void *ptr, size_t size) {
+      DocNodePool::release(ptr, size);
+   }
+
    /*! Returns the kind of node. Provides runtime type information */
    virtual Kind kind() const = 0;
 
@@ -0,0 +1,299 @@
+/************************************************************************
+*
+* Copyright (C) 2014-2020 Barbara Geller & Ansel Sermersheim
+* Copyright (C) 1997-2014 by Dimitri van Heesch
+*
+* DoxyPress is free software: you can redistribute it and/or
+* modify it under the terms of the GNU General Public License version 2
+* as published by the Free Software Foundation.
+*
+* DoxyPress is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+*
+* Documents produced by DoxyPress are derivative works derived from the
+* input used in their production; they are not affected by this license.
+*
+*************************************************************************/
+
+
+#include <QFile>
+#include <QSet>
+#include <QTemporaryFile>
+
+#include <docstore.h>
+
+#include <message.h>
+#include <objcache.h>
+
+namespace {
+
+// smaller text is not worth a round trip to the side file
+const int s_spillThreshold = 256;
+
+// number of loaded texts kept in memory, 2 to the power of this value
+const int s_cacheLogSize = 14;
+
+struct StoreData {
+   QSet<SpillText *> pending;
+
+   QTemporaryFile *file = nullptr;
+   ObjCache *cache      = nullptr;
+   uchar *mapped        = nullptr;
+
+   int spilledCount     = 0;
+   qint64 spilledBytes  = 0;
+};
+
+StoreData &storeData()
+{
+   // never deleted, SpillText objects in static data may be destroyed after this point
+   static StoreData *retval = new StoreData;
+   return *retval;
+}
+
+}
+
+void DocStore::spill()
+{
+   StoreData &data = storeData();
+
+   if (data.pending.isEmpty() || data.file != nullptr) {
+      return;
+   }
+
+   data.file = new QTemporaryFile;
+
+   if (! data.file->open()) {
+      warn_uncond("Unable to create a temporary file for documentation text, text remains in memory\n");
+
+      delete data.file;
+      data.file = nullptr;
+
+      return;
+   }
+
+   for (auto item : data.pending) {
+      QByteArray bytes = item->m_text.toUtf8();
+
+      qint64 offset = data.file->pos();
+
+      if (data.file->write(bytes) != bytes.size()) {
+         // disk full, keep the remaining text in memory
+         break;
+      }
+
+      item->m_pending = false;
+      item->moveToStore(offset);
+
+      ++data.spilledCount;
+      data.spilledBytes += bytes.size();
+   }
+
+   // text which was not written stays resident
+   for (auto item : data.pending) {
+      item->m_pending = false;
+   }
+
+   data.pending.clear();
+   data.file->flush();
+
+   if (data.spilledBytes > 0) {
+      data.mapped = data.file->map(0, data.spilledBytes);
+   }
+
+   data.cache = new ObjCache(s_cacheLogSize);
+}
+
+void DocStore::printStats()
+{
+   StoreData &data = storeData();
+
+   if (data.cache == nullptr) {
+      return;
+   }
+
+   int hits   = data.cache->hits();
+   int misses = data.cache->misses();
+
+   msg("Documentation store: %d texts, %lld bytes spilled, cache hits %d, misses %d, hit ratio %.1f%%\n",
+         data.spilledCount, data.spilledBytes, hits, misses, (hits + misses) > 0 ? hits * 100.0 / (hits + misses) : 0.0);
+}
+
+void DocStore::close()
+{
+   StoreData &data = storeData();
+
+   delete data.cache;
+   data.cache = nullptr;
+
+   if (data.file != nullptr) {
+      if (data.mapped != nullptr) {
+         data.file->unmap(data.mapped);
+         data.mapped = nullptr;
+      }
+
+      delete data.file;
+      data.file = nullptr;
+   }
+}
+
+void DocStore::addPending(SpillText *text)
+{
+   StoreData &data = storeData();
+
+   if (data.file == nullptr) {
+      // only text which exists when parsing is finished is spilled
+      data.pending.insert(text);
+      text->m_pending = true;
+   }
+}
+
+void DocStore::removePending(SpillText *text)
+{
+   storeData().pending.remove(text);
+   text->m_pending = false;
+}
+
+QString DocStore::load(qint64 offset, int size)
+{
+   StoreData &data = storeData();
+
+   if (data.mapped != nullptr) {
+      return QString::fromUtf8(reinterpret_cast<const char *>(data.mapped + offset), size);
+   }
+
+   if (data.file == nullptr) {
+      return QString();
+   }
+
+   // mapping failed, read the text
+   qint64 oldPos = data.file->pos();
+
+   data.file->seek(offset);
+   QByteArray bytes = data.file->read(size);
+   data.file->seek(oldPos);
+
+   return QString::fromUtf8(bytes);
+}
+
+int DocStore::addToCache(SpillText *text)
+{
+   StoreData &data = storeData();
+
+   if (data.cache == nullptr) {
+      return -1;
+   }
+
+   void *victim = nullptr;
+   int handle   = data.cache->add(text, &victim);
+
+   if (victim != nullptr) {
+      static_cast<SpillText *>(victim)->release();
+   }
+
+   return handle;
+}
+
+void DocStore::removeFromCache(int handle)
+{
+   StoreData &data = storeData();
+
+   if (data.cache != nullptr) {
+      data.cache->del(handle);
+   }
+}
+
+void DocStore::useCache(int handle)
+{
+   StoreData &data = storeData();
+
+   if (data.cache != nullptr) {
+      data.cache->use(handle);
+   }
+}
+
+// **
+SpillText::SpillText()
+   : m_offset(-1), m_size(0), m_handle(-1), m_loaded(false), m_pending(false)
+{
+}
+
+SpillText::SpillText(const SpillText &other)
+   : m_offset(-1), m_size(0), m_handle(-1), m_loaded(false), m_pending(false)
+{
+   assign(other.text());
+}
+
+SpillText::~SpillText()
+{
+   assign(QString());
+}
+
+SpillText &SpillText::operator=(const SpillText &other)
+{
+   if (this != &other) {
+      assign(other.text());
+   }
+
+   return *this;
+}
+
+SpillText &SpillText::operator=(const QString &text)
+{
+   assign(text);
+   return *this;
+}
+
+QString SpillText::text() const
+{
+   if (m_offset >= 0) {
+
+      if (m_loaded) {
+         DocStore::useCache(m_handle);
+
+      } else {
+         m_text   = DocStore::load(m_offset, m_size);
+         m_loaded = true;
+         m_handle = DocStore::addToCache(const_cast<SpillText *>(this));
+      }
+   }
+
+   return m_text;
+}
+
+void SpillText::assign(const QString &text)
+{
+   // text which was spilled is replaced, the old bytes in the side file are not reused
+   if (m_handle != -1) {
+      DocStore::removeFromCache(m_handle);
+      m_handle = -1;
+   }
+
+   m_text   = text;
+   m_offset = -1;
+   m_size   = m_text.size_storage();
+   m_loaded = false;
+
+   if (m_size >= s_spillThreshold) {
+      if (! m_pending) {
+         DocStore::addPending(this);
+      }
+
+   } else if (m_pending) {
+      DocStore::removePending(this);
+   }
+}
+
+void SpillText::moveToStore(qint64 offset)
+{
+   m_offset = offset;
+   m_text   = QString();
+}
+
+void SpillText::release()
+{
+   m_text   = QString();
+   m_handle = -1;
+   m_loaded = false;
+}
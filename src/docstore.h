@@ -0,0 +1,102 @@
+/************************************************************************
+*
+* Copyright (C) 2014-2020 Barbara Geller & Ansel Sermersheim
+* Copyright (C) 1997-2014 by Dimitri van Heesch
+*
+* DoxyPress is free software: you can redistribute it and/or
+* modify it under the terms of the GNU General Public License version 2
+* as published by the Free Software Foundation.
+*
+* DoxyPress is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+*
+* Documents produced by DoxyPress are derivative works derived from the
+* input used in their production; they are not affected by this license.
+*
+*************************************************************************/
+
+
+#ifndef DOCSTORE_H
+#define DOCSTORE_H
+
+#include <QString>
+
+class SpillText;
+
+/** @brief Side file for large documentation text.
+ *
+ *  When parsing is finished spill() writes every large SpillText to a temporary file which
+ *  is then memory mapped. During output generation the text is read back on demand. An
+ *  ObjCache keeps the most recently used texts in memory and releases the others.
+ */
+class DocStore
+{
+ public:
+   /*! Moves all pending text to the side file */
+   static void spill();
+
+   /*! Print the number of spilled texts and the cache hit ratio */
+   static void printStats();
+
+   /*! Release the cache and remove the side file */
+   static void close();
+
+ private:
+   static void addPending(SpillText *text);
+   static void removePending(SpillText *text);
+
+   static QString load(qint64 offset, int size);
+   static int addToCache(SpillText *text);
+   static void removeFromCache(int handle);
+   static void useCache(int handle);
+
+   friend class SpillText;
+};
+
+/** @brief Text which can be moved to the DocStore
+ *
+ *  Text below a small size threshold always stays in memory. Copying a SpillText
+ *  copies the text, the copy is resident until the next spill. The text is returned
+ *  by value since a loaded text can be released when other text is loaded.
+ */
+class SpillText
+{
+ public:
+   SpillText();
+   SpillText(const SpillText &other);
+   ~SpillText();
+
+   SpillText &operator=(const SpillText &other);
+   SpillText &operator=(const QString &text);
+
+   QString text() const;
+
+   bool isEmpty() const {
+      return m_size == 0;
+   }
+
+   /*! Bytes of text currently held in memory */
+   int residentSize() const {
+      return m_text.size_storage();
+   }
+
+ private:
+   void assign(const QString &text);
+   void moveToStore(qint64 offset);
+   void release();
+
+   mutable QString m_text;
+
+   qint64 m_offset;            // position in the side file, -1 when the text is resident
+   int    m_size;              // size of the text in bytes
+
+   mutable int  m_handle;      // cache handle while the spilled text is loaded
+   mutable bool m_loaded;
+
+   bool m_pending;
+
+   friend class DocStore;
+};
+
+#endif
@@ -26,7 +26,7 @@ class IndexList;
 const QString versionString = QString::fromLatin1(versionLiteral);
 
 CiteDict         Doxy_Globals::citeDict;                   // database of bibliographic references
-ClassSDict       Doxy_Globals::classSDict;
+ClassSDict       Doxy_Globals::classSDict(Qt::CaseSensitive, true);
 ClassSDict       Doxy_Globals::hiddenClasses;
 
 ConceptSDict     Doxy_Globals::conceptSDict;
@@ -48,10 +48,10 @@ FileNameDict     Doxy_Globals::includeNameDict;           // include names
 FileNameDict     Doxy_Globals::imageNameDict;             // images
 FileNameDict     Doxy_Globals::mscFileNameDict;           // msc files
 
-MemberNameSDict  Doxy_Globals::memberNameSDict;
-MemberNameSDict  Doxy_Globals::functionNameSDict;
+MemberNameSDict  Doxy_Globals::memberNameSDict(true);
+MemberNameSDict  Doxy_Globals::functionNameSDict(true);
 
-NamespaceSDict   Doxy_Globals::namespaceSDict;
+NamespaceSDict   Doxy_Globals::namespaceSDict(true);
 
 PageSDict        Doxy_Globals::pageSDict;
 PageSDict        Doxy_Globals::exampleSDict;
@@ -87,6 +87,9 @@ QHash<long, QSharedPointer<MemberGroupInfo>> Doxy_Globals::memGrpInfoDict;    //
 
 StringMap<QSharedPointer<DirRelation>>       Doxy_Globals::dirRelations;
 QCache<QString, LookupInfo>                  Doxy_Globals::lookupCache;
+QCache<QString, QString>                     Doxy_Globals::canonicalTypeCache;       // (scope, file, type) to canonical type
+QHash<QString, QSharedPointer<MemberDef>>    Doxy_Globals::memberSignatureIndex;     // qualified member name + signature
+QCache<QString, bool>                        Doxy_Globals::unresolvedLinkCache;      // words which are known not to be links
 
 QString Doxy_Globals::htmlFileExtension;
 QString Doxy_Globals::latexStyleExtension = ".sty";
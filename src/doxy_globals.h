@@ -161,6 +161,9 @@ class Doxy_Globals
 
       static StringMap<QSharedPointer<DirRelation>>       dirRelations;
       static QCache<QString, LookupInfo>                  lookupCache;
+      static QCache<QString, QString>                     canonicalTypeCache;
+      static QHash<QString, QSharedPointer<MemberDef>>    memberSignatureIndex;
+      static QCache<QString, bool>                        unresolvedLinkCache;
 
       static QString htmlFileExtension;
       static QString latexStyleExtension;
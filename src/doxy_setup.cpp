@@ -120,7 +120,7 @@ void initDoxyPress()
    initFileMemberIndices();
 
    Doxy_Globals::globalScope       = QMakeShared<NamespaceDef>("<globalScope>", 1, 1, "<globalScope>");
-   Doxy_Globals::classSDict        = ClassSDict(Config::getCase("sort-class-case-sensitive"));
+   Doxy_Globals::classSDict        = ClassSDict(Config::getCase("sort-class-case-sensitive"), true);
 
    // initialize global constants
    Doxy_Globals::g_compoundKeywordDict.insert("template class");
@@ -21,6 +21,9 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <sys/stat.h>
+
+#include <future>
+#include <map>
 #include <set>
 
 #include <arguments.h>
@@ -31,8 +34,10 @@
 #include <declinfo.h>
 #include <default_args.h>
 #include <docbookgen.h>
+#include <docnodepool.h>
 #include <docparser.h>
 #include <docsets.h>
+#include <docstore.h>
 #include <dot.h>
 #include <doxy_setup.h>
 #include <doxy_globals.h>
@@ -52,6 +57,7 @@
 #include <outputlist.h>
 #include <parse_clang.h>
 #include <parse_cstyle.h>
+#include <parse_md.h>
 #include <parse_py.h>
 #include <perlmodgen.h>
 #include <portable.h>
@@ -382,6 +388,8 @@ namespace Doxy_Work{
                   QSharedPointer<FileDef> fd, QString fileName, enum ParserMode mode, QStringList &filesInSameTu);
 
    void parseFiles(QSharedPointer<Entry> ptrEntry);
+   void prefetchInputs(const QStringList &fileNames, int index, int &prefetched, bool markdownPages);
+   void prefetchMarkdownPages(const QStringList &fileNames);
 
    void processFiles();
    void processTagLessClasses(QSharedPointer<ClassDef> rootCd, QSharedPointer<ClassDef> cd, QSharedPointer<ClassDef>tagParentCd,
@@ -416,7 +424,7 @@ struct ReadDirArgs {
 };
 
    void readFileOrDirectory(const QString &fileName, ReadDirArgs &data);
-   void readDir(const QFileInfo &fileInfo, ReadDirArgs &data);
+   void readDir(const QFileInfo &fileInfo, ReadDirArgs &data, std::future<QFileInfoList> *listing = nullptr);
 
    void resolveClassNestingRelations();
    void resolveHiddenNamespace();
@@ -460,6 +468,8 @@ void processFiles()
 
    uint lookupSize = (65536 << cacheSize);
    Doxy_Globals::lookupCache.setMaxCost(lookupSize);
+   Doxy_Globals::canonicalTypeCache.setMaxCost(lookupSize);
+   Doxy_Globals::unresolvedLinkCache.setMaxCost(lookupSize);
 
 #ifdef HAS_SIGNALS
    signal(SIGINT, stopDoxyPress);
@@ -574,6 +584,19 @@ void processFiles()
    Config::setList("exclude-patterns", exclPatterns);
    searchInputFiles();
 
+   if (! Config::getString("file-version-filter").isEmpty()) {
+      // the input files are known, run the version filter for all of them at once
+      QStringList filePaths;
+
+      for (auto &fn : Doxy_Globals::inputNameList) {
+         for (auto &fd : *fn) {
+            filePaths.append(fd->getFilePath());
+         }
+      }
+
+      FileDef::prefetchFileVersions(filePaths);
+   }
+
    // **  Note: the order of the function calls below are important
 
    if (Config::getBool("generate-html")) {
@@ -654,6 +677,8 @@ void processFiles()
    // calling buildClassList may result in cached relations which become invalid
    // after resolveClassNestingRelations(), that is why we clear the cache here
    Doxy_Globals::lookupCache.clear();
+   Doxy_Globals::canonicalTypeCache.clear();
+   Doxy_Globals::unresolvedLinkCache.clear();
 
    // we do not need the list of using declaration anymore
    Doxy_Globals::g_usingDeclarations.clear();
@@ -772,6 +797,8 @@ void processFiles()
    Doxy_Globals::infoLog_Stat.end();
 
    msg("Freeing entry tree\n");
+   root->releaseSubEntries();
+   root = QSharedPointer<Entry>();
 
    Doxy_Globals::infoLog_Stat.begin("Determining which enums are documented\n");
    findDocumentedEnumValues();
@@ -780,6 +807,7 @@ void processFiles()
    Doxy_Globals::infoLog_Stat.begin("Computing member relations\n");
    mergeCategories();
    computeMemberRelations();
+   buildMemberSignatureIndex();
    Doxy_Globals::infoLog_Stat.end();
 
    Doxy_Globals::infoLog_Stat.begin("Building full member lists recursively\n");
@@ -877,6 +905,12 @@ void generateOutput()
    QString outputDir = Config::getString("output-dir");
    QDir::setCurrent(outputDir);
 
+   // words which failed to resolve while parsing the input may be linkable now
+   Doxy_Globals::unresolvedLinkCache.clear();
+
+   // large documentation text is paged in from a side file while generating output
+   DocStore::spill();
+
    initSearchIndexer();
 
    // add extra languages for which we can only produce syntax highlighted code
@@ -1243,9 +1277,19 @@ void generateOutput()
    }
 
    msg("Lookup cache used %d/%d \n", Doxy_Globals::lookupCache.count(), Doxy_Globals::lookupCache.size());
+   DocStore::printStats();
+
+   if (Debug::isFlagSet(Debug::Memory)) {
+      StringPool::printStats();
+      printSharedParseDocStats();
+      DocNodePool::printStats();
+      MemberDef::printMemoryUsage();
+   }
    msg("Finished\n");
 
    // all done, cleaning up and exit
+   clearSharedParseDocCache();
+   DocStore::close();
    shutDownDoxyPress();
    Doxy_Globals::programExit = true;
 }
@@ -2686,7 +2730,7 @@ void Doxy_Work::processTagLessClasses(QSharedPointer<ClassDef> rootCd, QSharedPo
                      if (pml) {
 
                         for (auto pmd : *pml) {
-                           if (pmd->name() == md->name()) {
+                           if (pmd->hasSameName(*md)) {
                               pmd->setAccessorType(ncd, substitute(pmd->typeString(), icd->name(), ncd->name()));
                            }
                         }
@@ -8948,6 +8992,8 @@ void Doxy_Work::flushCachedTemplateRelations()
    // have inheritance instances as direct or indirect sub classes.
 
    Doxy_Globals::lookupCache.clear();
+   Doxy_Globals::canonicalTypeCache.clear();
+   Doxy_Globals::unresolvedLinkCache.clear();
 
    // remove all cached typedef resolutions whose target is a
    // template class as this may now be a template instance
@@ -8998,6 +9044,8 @@ void Doxy_Work::flushUnresolvedRelations()
    // class C : public B::I {};
 
    Doxy_Globals::lookupCache.clear();
+   Doxy_Globals::canonicalTypeCache.clear();
+   Doxy_Globals::unresolvedLinkCache.clear();
 
    for (auto fn : Doxy_Globals::functionNameSDict) {
       // for each global function name
@@ -9704,28 +9752,37 @@ void Doxy_Work::parseFile(ParserInterface *parser, QSharedPointer<Entry> root,
    }
 
    QFileInfo fi(fileName);
-   QString fileContents;
+   QString buffer;
 
-   if (! clangParsing && enablePreprocessing && parser->needsPreprocessing(extension)) {
-      msg("Processing %s\n", csPrintable(fileName));
-
-      fileContents = readInputFile(fileName);
-      fileContents = preprocessFile(fileName, fileContents);
+   if (MarkdownFileParser::hasPrefetchedPage(fileName)) {
+      // read and converted by prefetchMarkdownPages(), the parser uses the converted page
+      msg("Reading %s\n", csPrintable(fileName));
 
    } else {
-      // no preprocessing, if clang processing this branch is forced
-      msg("Reading %s\n", csPrintable(fileName));
-      fileContents = readInputFile(fileName);
-   }
+      QString fileContents;
+
+      if (! clangParsing && enablePreprocessing && parser->needsPreprocessing(extension)) {
+         msg("Processing %s\n", csPrintable(fileName));
+
+         fileContents = preprocessFile(fileName, readInputFile(fileName));
+
+      } else {
+         // no preprocessing, if clang processing this branch is forced
+         msg("Reading %s\n", csPrintable(fileName));
+         fileContents = readInputFile(fileName);
+      }
+
+      if (! fileContents.endsWith("\n")) {
+         // add extra newline to help parser
+         fileContents += '\n';
+      }
 
-   if (! fileContents.endsWith("\n")) {
-      // add extra newline to help parser
-      fileContents += '\n';
+      // convert multi-line C++ comments to C style comments
+      // each stage takes over the buffer of the previous one, only input and output of a single pass are alive at a time
+      buffer = convertCppComments(std::move(fileContents), fileName);
    }
 
-   // convert multi-line C++ comments to C style comments
-   QString buffer = convertCppComments(fileContents, fileName);
-   auto srcLang   = fd->getLanguage();
+   auto srcLang = fd->getLanguage();
 
    if (clangParsing && (srcLang == SrcLangExt_Cpp || srcLang == SrcLangExt_ObjC)) {
       fd->getAllIncludeFilesRecursively(includedFiles);
@@ -9743,12 +9800,61 @@ void Doxy_Work::parseFile(ParserInterface *parser, QSharedPointer<Entry> root,
    root->createNavigationIndex(fd);
 }
 
+// read the markdown input files the same way parseFile() does and convert them ahead of time,
+// parseFile() does not read these files again
+void Doxy_Work::prefetchMarkdownPages(const QStringList &fileNames)
+{
+   QVector<QPair<QString, QString>> pages;
+
+   for (const auto &fName : fileNames) {
+      if (dynamic_cast<MarkdownFileParser *>(getParserForFile(fName)) == nullptr) {
+         continue;
+      }
+
+      QString fileContents = readInputFile(fName);
+
+      if (! fileContents.endsWith("\n")) {
+         fileContents += '\n';
+      }
+
+      pages.append(qMakePair(fName, convertCppComments(std::move(fileContents), fName)));
+   }
+
+   if (! pages.isEmpty()) {
+      MarkdownFileParser::prefetchPages(pages);
+   }
+}
+
+// run the input filters and convert the markdown pages for the next few input files concurrently, only
+// a window of files is prefetched ahead of parseFile() so the results do not pile up in memory
+void Doxy_Work::prefetchInputs(const QStringList &fileNames, int index, int &prefetched, bool markdownPages)
+{
+   static const int window = 4 * qMax(2, QThread::idealThreadCount());
+
+   if (index < prefetched) {
+      return;
+   }
+
+   QStringList nextFiles = fileNames.mid(index, window);
+   prefetched = index + static_cast<int>(nextFiles.size());
+
+   prefetchInputFilters(nextFiles);
+
+   if (markdownPages) {
+      prefetchMarkdownPages(nextFiles);
+   }
+}
+
 // parse the list of input files
 void Doxy_Work::parseFiles(QSharedPointer<Entry> root)
 {
    // user specified
    static const bool clangParsing = Config::getBool("clang-parsing");
 
+   // index of the first input file which has not been prefetched
+   int prefetched = 0;
+   int index      = 0;
+
    if (clangParsing) {
       QSet<QString> processedFiles;
       QSet<QString> filesToProcess;
@@ -9761,6 +9867,9 @@ void Doxy_Work::parseFiles(QSharedPointer<Entry> root)
       for (auto fName : Doxy_Globals::g_inputFiles) {
          bool ambig;
 
+         // markdown pages are parsed with the remaining files
+         prefetchInputs(Doxy_Globals::g_inputFiles, index++, prefetched, false);
+
          QSharedPointer<FileDef> fd = findFileDef(&Doxy_Globals::inputNameDict, fName, ambig);
          assert(fd != 0);
 
@@ -9799,8 +9908,21 @@ void Doxy_Work::parseFiles(QSharedPointer<Entry> root)
          }
       }
 
-      // process remaining files, treat as source files even if they are header files
+      QStringList remainingFiles;
+
       for (auto fName : Doxy_Globals::g_inputFiles) {
+         if (! processedFiles.contains(fName)) {
+            remainingFiles.append(fName);
+         }
+      }
+
+      prefetched = 0;
+      index      = 0;
+
+      // process remaining files, treat as source files even if they are header files
+      for (auto fName : remainingFiles) {
+
+         prefetchInputs(remainingFiles, index++, prefetched, true);
 
          if (! processedFiles.contains(fName)) {
             QStringList includedFiles;
@@ -9831,6 +9953,8 @@ void Doxy_Work::parseFiles(QSharedPointer<Entry> root)
 
          bool ambig;
 
+         prefetchInputs(Doxy_Globals::g_inputFiles, index++, prefetched, true);
+
          QSharedPointer<FileDef> fd = findFileDef(&Doxy_Globals::inputNameDict, fName, ambig);
          assert(fd != nullptr);
 
@@ -9982,11 +10106,34 @@ QString Doxy_Work::createOutputDirectory(const QString &baseDirName, const QStri
    return formatDirName;
 }
 
+// list the contents of a directory and fetch the attributes of each entry, called on a worker thread
+static QFileInfoList listDirectory(const QString &dirName)
+{
+   QDir dir(dirName);
+   dir.setFilter(QDir::Files | QDir::Dirs | QDir::Hidden);
+
+   QFileInfoList list = dir.entryInfoList();
+
+   for (auto &cfi : list) {
+      // each QFileInfo caches the result of the stat call
+      cfi.exists();
+      cfi.isReadable();
+      cfi.isSymLink();
+   }
+
+   return list;
+}
+
 // read all files matching at least one pattern in `patList' in the directory represented by `fi'
 // directory is read if the recursiveFlag is set, contents of all files is append to the input string
 
-void Doxy_Work::readDir(const QFileInfo &fi, ReadDirArgs &data)
+void Doxy_Work::readDir(const QFileInfo &fi, ReadDirArgs &data, std::future<QFileInfoList> *listing)
 {
+   static const int maxPrefetch = qMax(2, QThread::idealThreadCount());
+
+   // listings started and not yet taken over by a nested readDir, shared by all recursion levels
+   static int runningPrefetch = 0;
+
    static const bool excludeSymlink = Config::getBool("exclude-symlinks");
 
    QString dirName = fi.absoluteFilePath();
@@ -10009,13 +10156,38 @@ void Doxy_Work::readDir(const QFileInfo &fi, ReadDirArgs &data)
       Doxy_Globals::g_pathsVisited.insert(dirName);
    }
 
-   QDir dir(dirName);
-   dir.setFilter(QDir::Files | QDir::Dirs | QDir::Hidden);
-
    int totalSize = 0;
    msg("Searching for files in directory %s\n", csPrintable(fi.absoluteFilePath()) );
 
-   const QFileInfoList list = dir.entryInfoList();
+   const QFileInfoList list = (listing != nullptr && listing->valid()) ? listing->get() : listDirectory(dirName);
+
+   // sub directories are listed in parallel, they are still processed in order
+   QStringList subDirs;
+   std::map<QString, std::future<QFileInfoList>> prefetch;
+   int nextPrefetch = 0;
+
+   if (data.recursive) {
+      for (auto &cfi : list) {
+         // symlinked directories are listed after the link is resolved, they are not prefetched
+         if (cfi.isDir() && cfi.fileName().at(0) != '.' && ! data.excludeSet.contains(cfi.absoluteFilePath()) &&
+               ! cfi.isSymLink() && ! patternMatch(cfi, data.excludePatternList)) {
+
+            subDirs.append(cfi.absoluteFilePath());
+         }
+      }
+   }
+
+   auto startPrefetch = [&] () {
+      while (nextPrefetch < subDirs.size() && runningPrefetch < maxPrefetch) {
+         const QString &subDir = subDirs[nextPrefetch];
+         ++nextPrefetch;
+
+         prefetch.emplace(subDir, std::async(std::launch::async, listDirectory, subDir));
+         ++runningPrefetch;
+      }
+   };
+
+   startPrefetch();
 
    for (auto &cfi : list) {
       QString filePath = cfi.absoluteFilePath();
@@ -10087,11 +10259,27 @@ void Doxy_Work::readDir(const QFileInfo &fi, ReadDirArgs &data)
                }
 
                QFile tmp(filePath);
-               readDir(tmp, data);
+
+               auto iter = prefetch.find(filePath);
+
+               if (iter != prefetch.end()) {
+                  std::future<QFileInfoList> subList = std::move(iter->second);
+                  prefetch.erase(iter);
+                  --runningPrefetch;
+
+                  startPrefetch();
+                  readDir(tmp, data, &subList);
+
+               } else {
+                  readDir(tmp, data);
+               }
             }
          }
       }
    }
+
+   // listings which were not used, destroying the futures waits for them to finish
+   runningPrefetch -= static_cast<int>(prefetch.size());
 }
 
 // read a file or all files in a directory and append their contents to the
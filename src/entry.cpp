@@ -192,3 +192,23 @@ void Entry::removeSubEntry(QSharedPointer<Entry> e)
    }
 }
 
+void Entry::releaseSubEntries()
+{
+   // collect every node in the tree first so the entries are released in one pass
+   // the recursive destructor chain could otherwise overflow the stack on deep trees
+
+   QVector<QSharedPointer<Entry>> nodes = m_sublist;
+   m_sublist.clear();
+
+   for (int i = 0; i < nodes.size(); ++i) {
+      QSharedPointer<Entry> node = nodes[i];
+
+      if (! node->m_sublist.isEmpty()) {
+         nodes.append(node->m_sublist);
+         node->m_sublist.clear();
+      }
+   }
+
+   // all nodes are now leaves, dropping the vector frees the whole tree
+   nodes.clear();
+}
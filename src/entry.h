@@ -347,6 +347,9 @@ class Entry : public EnableSharedFromThis
    // Removes entry E from the list of children
    void removeSubEntry(QSharedPointer<Entry> e);
 
+   // releases all entries below this entry, without recursion
+   void releaseSubEntries();
+
    // restore the state of this Entry to the default value when constructed
    void reset();
 
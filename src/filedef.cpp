@@ -16,7 +16,11 @@
 *
 *************************************************************************/
 
+#include <QHash>
 #include <QProcess>
+#include <QThread>
+
+#include <deque>
 
 #include <filedef.h>
 
@@ -72,7 +76,7 @@ FileDef::FileDef(const QString &p, const QString &nm, const QString &lref, const
    static const bool fullPathNames = Config::getBool("full-path-names");
 
    m_path     = p;
-   m_filePath = m_path + nm;
+   m_filePath = m_path.str() + nm;
    m_fileName = nm;
    m_diskName = dn;
 
@@ -93,7 +97,7 @@ FileDef::FileDef(const QString &p, const QString &nm, const QString &lref, const
 
    setLanguage(getLanguageFromFileName(name()));
 
-   acquireFileVersion();
+   m_versionAcquired = false;
    m_subGrouping = Config::getBool("allow-sub-grouping");
 }
 
@@ -321,8 +325,8 @@ void FileDef::writeBriefDescription(OutputList &ol)
 
    if (hasBriefDescription()) {
 
-      DocRoot *rootNode = validatingParseDoc(briefFile(), briefLine(), self, QSharedPointer<MemberDef>(),
-                                             briefDescription(), true, false, "", true, false);
+      QSharedPointer<DocRoot> rootNode = sharedParseDoc(briefFile(), briefLine(), self, QSharedPointer<MemberDef>(),
+                                                       briefDescription(), true, false, "", true, false);
 
       if (rootNode && !rootNode->isEmpty()) {
          ol.startParagraph();
@@ -332,7 +336,7 @@ void FileDef::writeBriefDescription(OutputList &ol)
          ol.writeString(" - ");
          ol.popGeneratorState();
 
-         ol.writeDoc(rootNode, self, QSharedPointer<MemberDef>());
+         ol.writeDoc(rootNode.data(), self, QSharedPointer<MemberDef>());
 
          ol.pushGeneratorState();
          ol.disable(OutputGenerator::RTF);
@@ -349,8 +353,6 @@ void FileDef::writeBriefDescription(OutputList &ol)
          ol.popGeneratorState();
          ol.endParagraph();
       }
-
-      delete rootNode;
    }
 
    ol.writeSynopsis();
@@ -614,6 +616,7 @@ void FileDef::writeDocumentation(OutputList &ol)
    static const bool generateTreeView = Config::getBool("generate-treeview");
 
    QString versionTitle;
+   acquireFileVersion();
 
    if (! m_fileVersion.isEmpty()) {
       versionTitle = ("(" + m_fileVersion + ")");
@@ -869,6 +872,7 @@ void FileDef::writeSource(OutputList &ol, bool sameTu, QStringList &includedFile
 
    DevNullCodeDocInterface devNullIntf;
    QString title = m_docname;
+   acquireFileVersion();
 
    if (! m_fileVersion.isEmpty()) {
       title += (" (" + m_fileVersion + ")");
@@ -1519,45 +1523,147 @@ void FileDef::combineUsingRelations()
    }
 }
 
-void FileDef::acquireFileVersion()
+// file versions which were retrieved by prefetchFileVersions(), an empty version means the filter failed
+static QHash<QString, QString> &fileVersionCache()
+{
+   static QHash<QString, QString> retval;
+   return retval;
+}
+
+static bool hasFileVersion(const QString &filePath)
+{
+   return ! filePath.isEmpty() && filePath != "generated" && filePath != "graph_legend";
+}
+
+static QProcess *startVersionFilter(const QString &filePath)
 {
    static const QString vercmd = Config::getString("file-version-filter");
 
-   if (! vercmd.isEmpty() && ! m_filePath.isEmpty() && m_filePath != "generated" && m_filePath != "graph_legend") {
+   QStringList cmdList = vercmd.split(" ");
+   cmdList.append(filePath);
 
-      msg("File Version for %s", csPrintable(m_filePath));
+   QString execmd = cmdList.takeFirst();
 
-      QStringList cmdList = vercmd.split(" ");
-      cmdList.append(m_filePath);
+   QProcess *task = new QProcess;
+   task->start(execmd, cmdList);
 
-      QString execmd = cmdList.takeFirst();
+   return task;
+}
 
-      QProcess task;
-      task.start(execmd, cmdList);
+// wait for the filter to finish and return the version, returns false if the filter could not be run
+static bool finishVersionFilter(QProcess *task, QString &version)
+{
+   task->waitForFinished(-1);
 
-      task.waitForFinished(-1);
+   if (task->exitStatus() != QProcess::NormalExit) {
+      return false;
+   }
 
-      if (task.exitStatus() != QProcess::NormalExit) {
-         err(", unnable to execute %s\n", csPrintable(vercmd));
-         return;
-      }
+   // get the file version
+   QByteArray buffer = task->readAllStandardOutput();
+   version = QString::fromUtf8(buffer.trimmed());
 
-      // get the file version
-      QByteArray buffer = task.readAllStandardOutput();
+   return true;
+}
 
-      if (! buffer.isEmpty()) {
-         m_fileVersion = QString::fromUtf8(buffer.trimmed());
+static void reportFileVersion(const QString &filePath, const QString &version, bool ok)
+{
+   static const QString vercmd = Config::getString("file-version-filter");
 
-         if (! m_fileVersion.isEmpty()) {
-            msg(" -> %s\n", csPrintable(m_fileVersion));
-            return;
-         }
-      }
+   msg("File Version for %s", csPrintable(filePath));
 
+   if (! ok) {
+      err(", unnable to execute %s\n", csPrintable(vercmd));
+
+   } else if (! version.isEmpty()) {
+      msg(" -> %s\n", csPrintable(version));
+
+   } else {
       msg(", version was not found\n");
    }
 }
 
+void FileDef::prefetchFileVersions(const QStringList &filePaths)
+{
+   static const QString vercmd = Config::getString("file-version-filter");
+   static const int maxTasks   = qMax(2, QThread::idealThreadCount());
+
+   if (vercmd.isEmpty()) {
+      return;
+   }
+
+   QHash<QString, QString> &cache = fileVersionCache();
+
+   // filters which are running, oldest first
+   std::deque<std::pair<QString, QProcess *>> running;
+
+   auto finishOldest = [&running, &cache] () {
+      QString filePath = running.front().first;
+      QProcess *task   = running.front().second;
+      running.pop_front();
+
+      QString version;
+      bool ok = finishVersionFilter(task, version);
+      delete task;
+
+      reportFileVersion(filePath, version, ok);
+      cache.insert(filePath, version);
+   };
+
+   for (const auto &filePath : filePaths) {
+
+      if (! hasFileVersion(filePath) || cache.contains(filePath)) {
+         continue;
+      }
+
+      if (static_cast<int>(running.size()) >= maxTasks) {
+         finishOldest();
+      }
+
+      // mark as started so duplicate paths only run once
+      cache.insert(filePath, QString());
+      running.push_back(std::make_pair(filePath, startVersionFilter(filePath)));
+   }
+
+   while (! running.empty()) {
+      finishOldest();
+   }
+}
+
+void FileDef::acquireFileVersion() const
+{
+   static const QString vercmd = Config::getString("file-version-filter");
+
+   if (m_versionAcquired) {
+      return;
+   }
+
+   m_versionAcquired = true;
+
+   if (vercmd.isEmpty() || ! hasFileVersion(m_filePath)) {
+      return;
+   }
+
+   QHash<QString, QString> &cache = fileVersionCache();
+   auto iter = cache.find(m_filePath);
+
+   if (iter != cache.end()) {
+      m_fileVersion = iter.value();
+      return;
+   }
+
+   QProcess *task = startVersionFilter(m_filePath);
+
+   QString version;
+   bool ok = finishVersionFilter(task, version);
+   delete task;
+
+   reportFileVersion(m_filePath, version, ok);
+
+   m_fileVersion = version;
+   cache.insert(m_filePath, version);
+}
+
 QString FileDef::getSourceFileBase() const
 {
    if (Htags::useHtags) {
@@ -1657,17 +1763,21 @@ bool FileDef::isLinkableInProject() const
    return hasDocumentation() && ! isReference() && (showFiles || isLinkableViaGroup());
 }
 
-static void getAllIncludeFilesRecursively(QSet<QString> &filesVisited, QSharedPointer<const FileDef> fd, QStringList &incFiles)
+// read only traversal, the file definitions are owned by the global file name dictionaries
+static void getAllIncludeFilesRecursively(QSet<QString> &filesVisited, const FileDef *fd, QStringList &incFiles)
 {
    if (fd->includeFileList()) {
 
-      for (auto &item : *fd->includeFileList() ) {
-         if (item.fileDef && ! item.fileDef->isReference() && ! filesVisited.contains(item.fileDef->getFilePath())) {
+      for (const auto &item : *fd->includeFileList() ) {
+         if (item.fileDef && ! item.fileDef->isReference()) {
+            const QString filePath = item.fileDef->getFilePath();
 
-            incFiles.append(item.fileDef->getFilePath());
-            filesVisited.insert(item.fileDef->getFilePath());
+            if (! filesVisited.contains(filePath)) {
+               incFiles.append(filePath);
+               filesVisited.insert(filePath);
 
-            getAllIncludeFilesRecursively(filesVisited, item.fileDef, incFiles);
+               getAllIncludeFilesRecursively(filesVisited, item.fileDef.data(), incFiles);
+            }
          }
       }
    }
@@ -1675,10 +1785,8 @@ static void getAllIncludeFilesRecursively(QSet<QString> &filesVisited, QSharedPo
 
 void FileDef::getAllIncludeFilesRecursively(QStringList &incFiles) const
 {
-   QSharedPointer<const FileDef> self = sharedFrom(this);
-
    QSet<QString> includes;
-   ::getAllIncludeFilesRecursively(includes, self, incFiles);
+   ::getAllIncludeFilesRecursively(includes, this, incFiles);
 }
 
 QString FileDef::title() const
@@ -1688,5 +1796,6 @@ QString FileDef::title() const
 
 QString FileDef::fileVersion() const
 {
+   acquireFileVersion();
    return m_fileVersion;
 }
@@ -133,9 +133,13 @@ class FileDef : public Definition
 
    /*! Returns version of this file. */
    QString getVersion() const {
+      acquireFileVersion();
       return m_fileVersion;
    }
 
+   /*! Runs the file-version-filter for all files in the list on a pool of processes */
+   static void prefetchFileVersions(const QStringList &filePaths);
+
    bool isLinkableInProject() const override;
 
    bool isLinkable() const override {
@@ -254,9 +258,9 @@ class FileDef : public Definition
 
  protected:
    /**
-    * Retrieves the file version from version control system.
+    * Retrieves the file version from version control system, only done once when the version is first used.
     */
-   void acquireFileVersion();
+   void acquireFileVersion() const;
 
  private:
    QSharedPointer<MemberList> createMemberList(MemberListType lt);
@@ -288,7 +292,7 @@ class FileDef : public Definition
 
    StringMap<QSharedPointer<Definition>>  m_usingDeclList;
 
-   QString m_path;
+   PoolString m_path;        // directory, shared by all files in the same directory
    QString m_filePath;
    QString m_diskName;
    QString m_fileName;
@@ -298,7 +302,8 @@ class FileDef : public Definition
    QHash<long, QSharedPointer<MemberDef>>  m_srcMemberDict;
 
    bool               m_isSource;
-   QString            m_fileVersion;
+   mutable bool       m_versionAcquired;
+   mutable QString    m_fileVersion;
 
    QSharedPointer<PackageDef> m_package;
 
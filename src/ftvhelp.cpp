@@ -339,7 +339,7 @@ static void generateBriefDoc(QTextStream &t, QSharedPointer<Definition> def)
    QString brief = def->briefDescription(true);
 
    if (! brief.isEmpty()) {
-      DocNode *root = validatingParseDoc(def->briefFile(), def->briefLine(),
+      QSharedPointer<DocRoot> root = sharedParseDoc(def->briefFile(), def->briefLine(),
                   def, QSharedPointer<MemberDef>(), brief, false, false, "", true, true);
 
       QString relPath = relativePathToRoot(def->getOutputFileBase());
@@ -349,7 +349,6 @@ static void generateBriefDoc(QTextStream &t, QSharedPointer<Definition> def)
       root->accept(visitor);
 
       delete visitor;
-      delete root;
    }
 }
 
@@ -620,11 +619,11 @@ static bool generateJSTree(SortedList<NavIndexEntry *> &navIndex, QTextStream &t
                bool src = srcFileVisibleInIndex(fd);
 
                if (node->category == DirType::File && doc) {
-                  navIndex.inSort(new NavIndexEntry(node2URL(node, true, false), pathToNode(node)));
+                  navIndex.appendUnsorted(new NavIndexEntry(node2URL(node, true, false), pathToNode(node)));
                }
 
                if (node->category == DirType::FileSource && src) {
-                  navIndex.inSort(new NavIndexEntry(node2URL(node, true, true), pathToNode(node)));
+                  navIndex.appendUnsorted(new NavIndexEntry(node2URL(node, true, true), pathToNode(node)));
                }
             }
 
@@ -634,7 +633,7 @@ static bool generateJSTree(SortedList<NavIndexEntry *> &navIndex, QTextStream &t
                // do not add this file to the navIndex
 
             } else {
-               navIndex.inSort(new NavIndexEntry(node2URL(node), pathToNode(node)));
+               navIndex.appendUnsorted(new NavIndexEntry(node2URL(node), pathToNode(node)));
 
             }
          }
@@ -784,10 +783,10 @@ static void generateJSNavTree(QList<FTVNode *> &nodeList)
       t << "\"index" << Doxy_Globals::htmlFileExtension << "\", ";
 
       // add one special entry for index page
-      navIndex.inSort(new NavIndexEntry("index" + Doxy_Globals::htmlFileExtension, ""));
+      navIndex.appendUnsorted(new NavIndexEntry("index" + Doxy_Globals::htmlFileExtension, ""));
 
       // add one special entry for related pages, written as a child of index.html
-      navIndex.inSort(new NavIndexEntry("pages" + Doxy_Globals::htmlFileExtension, ""));
+      navIndex.appendUnsorted(new NavIndexEntry("pages" + Doxy_Globals::htmlFileExtension, ""));
 
       // adjust for display output
       reSortNodes(nodeList);
@@ -795,6 +794,9 @@ static void generateJSNavTree(QList<FTVNode *> &nodeList)
       bool omitComma = true;
       generateJSTree(navIndex, t, nodeList, 1, omitComma);
 
+      // entries were collected unsorted during the tree walk
+      navIndex.sortAppended();
+
       if (omitComma) {
          t << "]" << endl;
       } else {
@@ -3827,11 +3827,11 @@ static bool recognizeFixedForm(const QString &contents)
  */
 
 // main entry point
-QString convertCppComments(const QString &inBuf, const QString &fileName)
+QString convertCppComments(QString inBuf, const QString &fileName)
 {
    s_mlBrief  = Config::getBool("multiline-cpp-brief");
 
-   s_inputString  = inBuf;
+   s_inputString  = std::move(inBuf);
    s_outputString       = "";
 
    s_inputPosition = 0;
@@ -3850,7 +3850,7 @@ QString convertCppComments(const QString &inBuf, const QString &fileName)
    isFixedForm = false;
 
    if (s_lang == SrcLangExt_Fortran) {
-      isFixedForm = recognizeFixedForm(inBuf);
+      isFixedForm = recognizeFixedForm(s_inputString);
    }
 
    if (s_lang == SrcLangExt_Markdown) {
@@ -3902,5 +3902,8 @@ QString convertCppComments(const QString &inBuf, const QString &fileName)
    s_commentStack.clear();
    s_nestingCount = 0;
 
-   return s_outputString;
+   // release the input, the output is moved to the caller
+   s_inputString = QString();
+
+   return std::move(s_outputString);
 }
@@ -4132,6 +4132,10 @@ static void groupAddDocs(QSharedPointer<Entry> e);
 
 static QString          s_inputString;         // input string
 static int              s_inputPosition;       // read pointer
+
+static QString          s_pendingComment;      // comment whose processed input is still in s_inputString
+static QString          s_pendingFileName;     // file the pending comment was read from
+static bool             s_pendingValid = false;
 static int              s_prevPosition;
 static char            *s_bufferPosition;
 
@@ -9629,10 +9633,17 @@ bool parseCommentBlock(ParserInterface *parser, QSharedPointer<Entry> curEntry,
 
    if (comment.isEmpty()) {
       // avoid empty strings
+      s_pendingValid = false;
       return false;
    }
 
-   if (Doxy_Globals::markdownSupport) {
+   if (s_pendingValid && r_position > 0 && fileName == s_pendingFileName && comment == s_pendingComment) {
+      // continuing a block which was split into several entries, the processed input is still valid
+
+   } else if (Doxy_Globals::markdownSupport) {
+      // buffer is rebuilt, it no longer holds the input of a pending comment
+      s_pendingValid = false;
+
       s_inputString = processMarkdown(fileName, lineNr, QSharedPointer<Entry>(), comment);
 
       QStringView tmp(s_inputString);
@@ -9651,12 +9662,15 @@ bool parseCommentBlock(ParserInterface *parser, QSharedPointer<Entry> curEntry,
 
       s_inputString = QString(tmp);
 
+      s_inputString.append(" ");
+
    } else {
+      s_pendingValid = false;
+
       s_inputString  = comment;
+      s_inputString.append(" ");
    }
 
-   s_inputString.append(" ");
-
    yyFileName       = fileName;
    yyLineNr         = lineNr;
    langParser       = parser;
@@ -9742,8 +9756,19 @@ bool parseCommentBlock(ParserInterface *parser, QSharedPointer<Entry> curEntry,
 
    if (s_parseMore) {
       r_position = s_inputPosition;
+
+      // caller will pass the same comment again to parse the remainder, s_inputString holds its processed input
+      if (! s_pendingValid) {
+         s_pendingComment  = comment;
+         s_pendingFileName = fileName;
+         s_pendingValid    = true;
+      }
+
    } else {
       r_position = 0;
+
+      s_pendingValid = false;
+      s_pendingComment.clear();
    }
 
    lineNr = yyLineNr;
@@ -2944,7 +2944,15 @@ class DefineManager
    class DefinesPerFile
    {
     public:
-      DefinesPerFile() {
+      // files used to build a flattened define set, with the version of each file at that time
+      struct FlattenState {
+         QVector<QPair<const DefinesPerFile *, int>> files;
+         QStringList missingFiles;
+      };
+
+      DefinesPerFile()
+         : m_version(0)
+      {
       }
 
       virtual ~DefinesPerFile() {
@@ -2963,20 +2971,36 @@ class DefineManager
          }
 
          m_defines.insert(def->m_name, def);
+         ++m_version;
       }
 
       /** Adds an include file for this file
        *  @param fileName The name of the include file
        */
       void addInclude(const QString &fileName) {
-         m_includedFiles.insert(fileName);
+         if (! m_includedFiles.contains(fileName)) {
+            m_includedFiles.insert(fileName);
+            ++m_version;
+         }
       }
 
-      void collectDefines(DefineDict &dict, QSet<QString> &includeStack);
+      void collectDefines(DefineDict &dict, QSet<QString> &includeStack, FlattenState *state = nullptr);
+
+      /** Returns the defines of this file and all files it includes. The set is built once
+       *  and shared until one of the files it was built from changes. A file which adds no
+       *  defines to the set of one of its include files shares the set of that file.
+       */
+      QSharedPointer<const DefineDict> flattenedDefines();
 
     private:
+      bool isFlattenedValid() const;
+
       DefineDict m_defines;
       QSet<QString> m_includedFiles;
+
+      int m_version;
+      QSharedPointer<const DefineDict> m_flattened;
+      FlattenState m_flattenState;
    };
 
  public:
@@ -3000,6 +3024,7 @@ class DefineManager
     *  @param fileName the name of the file to process.
     */
    void startContext(const QString &fileName) {
+      m_contextBase.clear();
       m_contextDefines.clear();
       if (fileName.isEmpty()) {
          return;
@@ -3018,6 +3043,7 @@ class DefineManager
     *  defines collected within in this context.
     */
    void endContext() {
+      m_contextBase.clear();
       m_contextDefines.clear();
    }
 
@@ -3039,10 +3065,25 @@ class DefineManager
          m_fileMap.insert(fileName, dpf);
 
       } else {
-         // existing file
+         // existing file, merge the define set of the file and everything it includes
+         QSharedPointer<const DefineDict> defines = dpf->flattenedDefines();
 
-         QSet<QString> includeStack;
-         dpf->collectDefines(m_contextDefines, includeStack);
+         if (m_contextBase == nullptr && m_contextDefines.isEmpty()) {
+            // first set is used as is, later sets only add what differs from it
+            m_contextBase = defines;
+
+         } else {
+            for (auto iter = defines->begin(); iter != defines->end(); ++iter) {
+
+               if (m_contextBase != nullptr && ! m_contextDefines.contains(iter.key()) &&
+                     m_contextBase->value(iter.key()) == iter.value()) {
+                  // already visible through the shared set
+                  continue;
+               }
+
+               m_contextDefines.insert(iter.key(), iter.value());
+            }
+         }
       }
    }
 
@@ -3098,6 +3139,10 @@ class DefineManager
    QSharedPointer<A_Define> isDefined(const QString &name) const {
       QSharedPointer<A_Define> d = m_contextDefines.value(name);
 
+      if (d == nullptr && m_contextBase != nullptr) {
+         d = m_contextBase->value(name);
+      }
+
       if (d && d->undef) {
          d = QSharedPointer<A_Define>();
       }
@@ -3105,11 +3150,6 @@ class DefineManager
       return d;
    }
 
-   /** Returns a reference to the defines found in the current context. */
-   const DefineDict &defineContext() const {
-      return m_contextDefines;
-   }
-
  private:
    static DefineManager *theInstance;
 
@@ -3143,6 +3183,9 @@ class DefineManager
    }
 
    QHash<QString, QSharedPointer<DefinesPerFile>> m_fileMap;
+
+   // defines of the current context, the shared set of the first include file and the defines added on top of it
+   QSharedPointer<const DefineDict> m_contextBase;
    DefineDict m_contextDefines;
 };
 
@@ -3156,7 +3199,7 @@ DefineManager *DefineManager::theInstance = 0;
  *  @param includeStack The stack of includes, used to stop recursion in
  *         case there is a cyclic include dependency.
  */
-void DefineManager::DefinesPerFile::collectDefines(DefineDict &dict, QSet<QString> &includeStack)
+void DefineManager::DefinesPerFile::collectDefines(DefineDict &dict, QSet<QString> &includeStack, FlattenState *state)
 {
    {
       for (auto di : m_includedFiles) {
@@ -3164,9 +3207,20 @@ void DefineManager::DefinesPerFile::collectDefines(DefineDict &dict, QSet<QStrin
 
          QSharedPointer<DefinesPerFile> dpf = DefineManager::instance().find(incFile);
 
-         if (dpf && ! includeStack.contains(incFile)) {
+         if (dpf == nullptr) {
+            if (state != nullptr) {
+               // define set changes once this file is preprocessed
+               state->missingFiles.append(incFile);
+            }
+
+         } else if (! includeStack.contains(incFile)) {
             includeStack.insert(incFile);
-            dpf->collectDefines(dict, includeStack);
+
+            if (state != nullptr) {
+               state->files.append(QPair<const DefinesPerFile *, int>(dpf.data(), dpf->m_version));
+            }
+
+            dpf->collectDefines(dict, includeStack, state);
          }
       }
    }
@@ -3185,6 +3239,65 @@ void DefineManager::DefinesPerFile::collectDefines(DefineDict &dict, QSet<QStrin
    }
 }
 
+QSharedPointer<const DefineDict> DefineManager::DefinesPerFile::flattenedDefines()
+{
+   if (m_flattened != nullptr && isFlattenedValid()) {
+      return m_flattened;
+   }
+
+   QSharedPointer<DefineDict> dict = QMakeShared<DefineDict>();
+   QSet<QString> includeStack;
+
+   m_flattenState = FlattenState();
+   m_flattenState.files.append(QPair<const DefinesPerFile *, int>(this, m_version));
+
+   collectDefines(*dict, includeStack, &m_flattenState);
+   m_flattened = dict;
+
+   // share the set of an include file if this file adds nothing to it, wrapper headers do not need a copy
+   for (const auto &item : m_includedFiles) {
+      QSharedPointer<DefinesPerFile> dpf = DefineManager::instance().find(item);
+
+      if (dpf == nullptr || dpf->m_flattened == nullptr || dpf->m_flattened->size() != dict->size() ||
+            ! dpf->isFlattenedValid()) {
+         continue;
+      }
+
+      bool same = true;
+
+      for (auto iter = dict->begin(); iter != dict->end(); ++iter) {
+         if (dpf->m_flattened->value(iter.key()) != iter.value()) {
+            same = false;
+            break;
+         }
+      }
+
+      if (same) {
+         m_flattened = dpf->m_flattened;
+         break;
+      }
+   }
+
+   return m_flattened;
+}
+
+bool DefineManager::DefinesPerFile::isFlattenedValid() const
+{
+   for (const auto &item : m_flattenState.files) {
+      if (item.first->m_version != item.second) {
+         return false;
+      }
+   }
+
+   for (const auto &item : m_flattenState.missingFiles) {
+      if (DefineManager::instance().find(item) != nullptr) {
+         return false;
+      }
+   }
+
+   return true;
+}
+
 static QStringList              s_pathList;
 static QString                  s_yyFileName;
 static QSharedPointer<FileDef>  s_yyFileDef;
@@ -3247,6 +3360,15 @@ static bool         s_ccomment;
 static QSet<QString> s_allIncludes;
 static QSet<QString> s_expansionDict;
 
+// input files which were preprocessed as the main file, the defines of these files are already known
+static QSet<QString> s_preprocessedFiles;
+
+// macros looked up while expanding, used to validate a cached expansion
+using MacroDeps = QVector<QPair<QString, QSharedPointer<A_Define>>>;
+
+static MacroDeps   *s_expansionDeps = nullptr;
+static bool         s_expansionUsedInput;
+
 #define MAX_EXPANSION_DEPTH 50
 
 static void setFileName(const QString &name)
@@ -3303,14 +3425,98 @@ static void setCaseDone(bool value)
    s_levelGuard.top() = value;
 }
 
+// the file system does not change while the input is processed, results of probing a path are kept
+static bool isExistingFile(const QString &fileName)
+{
+   static QHash<QString, bool> fileCache;
+
+   auto iter = fileCache.find(fileName);
+
+   if (iter != fileCache.end()) {
+      return iter.value();
+   }
+
+   QFileInfo fi(fileName);
+   bool retval = fi.exists() && fi.isFile();
+
+   fileCache.insert(fileName, retval);
+
+   return retval;
+}
+
+// directories from include-path which exist, validated once
+static const QStringList &validIncludePaths()
+{
+   static const QStringList retval = [] () {
+      QStringList list;
+
+      for (const auto &item : Config::getList("include-path")) {
+         QFileInfo fi(item);
+
+         if (fi.exists() && fi.isDir()) {
+            list.append(fi.absoluteFilePath());
+         }
+      }
+
+      return list;
+   } ();
+
+   return retval;
+}
+
+// absolute name of an include file relative to the including file or the include path,
+// returns an empty string if the file was not found
+static QString resolveIncludeName(const QString &includerName, const QString &incFileName)
+{
+   static bool searchIncludes = Config::getBool("search-includes");
+
+   // includes with the same spelling from the same directory resolve to the same file, misses are cached as well
+   static QHash<QString, QString> resolvedCache;
+
+   if (! isExistingFile(includerName)) {
+      return QString();
+   }
+
+   QFileInfo fi(includerName);
+   QString includerDir = fi.absolutePath();
+
+   QString key = includerDir + '\n' + incFileName;
+   auto iter   = resolvedCache.find(key);
+
+   if (iter != resolvedCache.end()) {
+      return iter.value();
+   }
+
+   QString retval;
+   QFileInfo fi2(includerDir + "/" + incFileName);
+
+   if (fi2.exists()) {
+      retval = fi2.absoluteFilePath();
+
+   } else if (searchIncludes) {
+
+      for (const auto &dir : validIncludePaths()) {
+         QFileInfo fi3(dir + "/" + incFileName);
+
+         if (fi3.exists()) {
+            retval = fi3.absoluteFilePath();
+            break;
+         }
+      }
+   }
+
+   resolvedCache.insert(key, retval);
+
+   return retval;
+}
+
 static QSharedPointer<FileState> checkAndOpenFile(const QString &fileName, bool &alreadyIncluded)
 {
    alreadyIncluded = false;
    QSharedPointer<FileState> fs;
 
-   QFileInfo fi(fileName);
-
-   if (fi.exists() && fi.isFile()) {
+   if (isExistingFile(fileName)) {
+      QFileInfo fi(fileName);
       static const QStringList exclPatterns = Config::getList("exclude-patterns");
 
       if (patternMatch(fi, exclPatterns)) {
@@ -3323,7 +3529,8 @@ static QSharedPointer<FileState> checkAndOpenFile(const QString &fileName, bool
       if (s_curlyCount == 0) {
          // not #include inside { ... }
 
-         if (s_allIncludes.contains(absName)) {
+         if (s_allIncludes.contains(absName) || s_preprocessedFiles.contains(absName)) {
+            // defines were added to the context by addFileToContext(), no need to scan the file again
             alreadyIncluded = true;
             return QSharedPointer<FileState>();
          }
@@ -3388,7 +3595,7 @@ static QSharedPointer<FileState> findFile(const QString &fileName, bool localInc
    if (localInclude && ! s_yyFileName.isEmpty()) {
       QFileInfo fi(s_yyFileName);
 
-      if (fi.exists()) {
+      if (isExistingFile(s_yyFileName)) {
          QString absName = fi.absolutePath() + "/" + fileName;
          QSharedPointer<FileState> fs = checkAndOpenFile(absName, alreadyIncluded);
 
@@ -4033,6 +4240,10 @@ static bool expandExpression(QString &expr, QString *rest, int pos, int level)
             // expand macro
             QSharedPointer<A_Define> def = DefineManager::instance().isDefined(macroName);
 
+            if (s_expansionDeps != nullptr) {
+               s_expansionDeps->append(qMakePair(macroName, def));
+            }
+
             if (macroName == "defined") {
                definedTest = true;
 
@@ -4476,15 +4687,71 @@ bool computeExpression(const QString &expr)
  *  If needed the function may read additional characters from the input
  */
 
+struct MacroExpansion {
+   QString result;
+   MacroDeps deps;
+};
+
+static QHash<QString, MacroExpansion> s_expansionCache;
+
+static int s_expansionHits   = 0;
+static int s_expansionMisses = 0;
+
+// a cached expansion is reused when every macro it looked up still has the same definition
+static bool isExpansionValid(const MacroExpansion &item)
+{
+   for (const auto &dep : item.deps) {
+      if (DefineManager::instance().isDefined(dep.first) != dep.second) {
+         return false;
+      }
+   }
+
+   return true;
+}
+
 QString expandMacro(const QString &name)
 {
+   // only expansions started outside of another expansion are cached
+   bool useCache = s_expandedDict->isEmpty();
+
+   QString key;
+
+   if (useCache) {
+      key = (s_nospaces ? "1:" : "0:") + name;
+
+      auto iter = s_expansionCache.find(key);
+
+      if (iter != s_expansionCache.end() && isExpansionValid(iter.value())) {
+         ++s_expansionHits;
+         return iter.value().result;
+      }
+
+      ++s_expansionMisses;
+   }
+
    QString n = name;
+   MacroDeps deps;
+
+   s_expansionDeps      = useCache ? &deps : nullptr;
+   s_expansionUsedInput = false;
 
    s_expansionDict.clear();
    expandExpression(n, nullptr, 0, 0);
 
+   s_expansionDeps = nullptr;
+
    n = removeMarkers(n);
 
+   if (useCache && ! s_expansionUsedInput) {
+      // expansions which read from the input, for example arguments which continue on the next line, are not cached
+
+      if (s_expansionCache.size() > 100000) {
+         s_expansionCache.clear();
+      }
+
+      s_expansionCache.insert(key, MacroExpansion{n, deps});
+   }
+
    return n;
 }
 
@@ -4590,7 +4857,6 @@ static inline void outputArray(const QString &a, int len)
 
 static void readIncludeFile(const QString &inc)
 {
-   static bool searchIncludes = Config::getBool("search-includes");
    uint i = 0;
 
    // find the start of the include file name
@@ -4625,39 +4891,10 @@ static void readIncludeFile(const QString &inc)
       int oldLineNr = s_yyLineNr;
 
       // absIncFileName avoids difficulties for incFileName starting with "../" (bug 641336)
-      QString absIncFileName = incFileName;
-      {
-         QFileInfo fi(s_yyFileName);
-
-         if (fi.exists()) {
-            QString absName = fi.absolutePath() + "/" + incFileName;
+      QString absIncFileName = resolveIncludeName(s_yyFileName, incFileName);
 
-            QFileInfo fi2(absName);
-            if (fi2.exists()) {
-               absIncFileName = fi2.absoluteFilePath();
-
-            } else if (searchIncludes) {
-               const QStringList includePath = Config::getList("include-path");
-
-               for (auto s : includePath) {
-
-                  QFileInfo fi(s);
-
-                  if (fi.exists() && fi.isDir()) {
-                     QString absName = fi.absoluteFilePath() + "/" + incFileName;
-
-                     QFileInfo fi2(absName);
-                     if (fi2.exists()) {
-                        absIncFileName = fi2.absoluteFilePath();
-                        break;
-                     }
-
-                  }
-
-               }
-            }
-
-         }
+      if (absIncFileName.isEmpty()) {
+         absIncFileName = incFileName;
       }
 
       DefineManager::instance().addInclude(s_yyFileName, absIncFileName);
@@ -8340,6 +8577,7 @@ static int getNextChar(const QString &expr, QString *rest, uint &pos)
 
    } else {
       int cc = yyinput();
+      s_expansionUsedInput = true;
 
       return cc;
    }
@@ -8356,6 +8594,7 @@ static int getCurrentChar(const QString &expr, QString *rest, uint pos)
 
    } else {
       int cc = yyinput();
+      s_expansionUsedInput = true;
 
       returnCharToStream(cc);
       return cc;
@@ -8374,6 +8613,7 @@ static void unputChar(const QString &expr, QString *rest, uint &pos, char c)
       rest->prepend(cs);
 
    } else {
+      s_expansionUsedInput = true;
 
       returnCharToStream(c);
    }
@@ -8396,13 +8636,20 @@ void initPreprocessor()
 
 void removePreProcessor()
 {
+   if (Debug::isFlagSet(Debug::Preprocessor)) {
+      Debug::print(Debug::Preprocessor, 0, "Macro expansion cache: hits %d, misses %d, entries %d\n",
+            s_expansionHits, s_expansionMisses, static_cast<int>(s_expansionCache.size()));
+   }
+
+   s_expansionCache.clear();
+
    s_expandedDict = QSharedPointer<DefineDict>();
    s_pathList.clear();
 
    DefineManager::deleteInstance();
 }
 
-QString preprocessFile(const QString &fileName, const QString &input)
+QString preprocessFile(const QString &fileName, QString input)
 {
    printlex(preYY_flex_debug, true, __FILE__, fileName);
 
@@ -8414,7 +8661,7 @@ QString preprocessFile(const QString &fileName, const QString &input)
    s_nospaces    = false;
 
    s_inputPosition  = 0;
-   s_inputString    = input;
+   s_inputString    = std::move(input);
    s_outputString   = "";
 
    s_includeStack.clear();
@@ -8598,10 +8845,15 @@ QString preprocessFile(const QString &fileName, const QString &input)
    // make sure we do not extend a \cond with missing \endcond over multiple files
    forceEndCondSection();
 
+   s_preprocessedFiles.insert(QFileInfo(fileName).absoluteFilePath());
+
    DefineManager::instance().endContext();
    printlex(preYY_flex_debug, false, __FILE__, fileName);
 
-   return s_outputString;
+   // release the input, the output is moved to the caller
+   s_inputString = QString();
+
+   return std::move(s_outputString);
 }
 
 void preFreeScanner()
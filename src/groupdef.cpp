@@ -736,8 +736,8 @@ void GroupDef::writeBriefDescription(OutputList &ol)
    QSharedPointer<GroupDef> self = sharedFrom(this);
 
    if (hasBriefDescription()) {
-      DocRoot *rootNode = validatingParseDoc(briefFile(), briefLine(), self, QSharedPointer<MemberDef>(),
-                                             briefDescription(), true, false, "", true, false);
+      QSharedPointer<DocRoot> rootNode = sharedParseDoc(briefFile(), briefLine(), self, QSharedPointer<MemberDef>(),
+                                                       briefDescription(), true, false, "", true, false);
 
       if (rootNode && !rootNode->isEmpty()) {
          ol.startParagraph();
@@ -747,7 +747,7 @@ void GroupDef::writeBriefDescription(OutputList &ol)
          ol.writeString(" - ");
          ol.popGeneratorState();
 
-         ol.writeDoc(rootNode, self, QSharedPointer<MemberDef>());
+         ol.writeDoc(rootNode.data(), self, QSharedPointer<MemberDef>());
          ol.pushGeneratorState();
          ol.disable(OutputGenerator::RTF);
          ol.writeString(" \n");
@@ -763,8 +763,6 @@ void GroupDef::writeBriefDescription(OutputList &ol)
          ol.popGeneratorState();
          ol.endParagraph();
       }
-
-      delete rootNode;
    }
 
    ol.writeSynopsis();
@@ -1321,17 +1321,21 @@ static void writeFileIndex(OutputList &ol)
             QSharedPointer<FileList> fl = outputNameMap.value(path);
 
             if (fl) {
-               fl->inSort(fd);
+               fl->appendUnsorted(fd);
 
             } else {
 
                fl = QMakeShared<FileList>();
-               fl->inSort(fd);
+               fl->appendUnsorted(fd);
 
                outputNameMap.insert(path, fl);
             }
          }
       }
+
+      for (auto &fl : outputNameMap) {
+         fl->sortAppended();
+      }
    }
 
    ol.startIndexList();
@@ -1499,17 +1503,21 @@ static void writeFileSourceIndex(OutputList &ol)
             QSharedPointer<FileList> fl = outputNameMap.value(path);
 
             if (fl) {
-               fl->inSort(fd);
+               fl->appendUnsorted(fd);
 
             } else {
 
                fl = QMakeShared<FileList>();
-               fl->inSort(fd);
+               fl->appendUnsorted(fd);
 
                outputNameMap.insert(path, fl);
             }
          }
       }
+
+      for (auto &fl : outputNameMap) {
+         fl->sortAppended();
+      }
    }
 
    ol.startIndexList();
@@ -21,6 +21,8 @@
 #include <stdio.h>
 #include <assert.h>
 
+#include <memory>
+
 #include <memberdef.h>
 
 #include <arguments.h>
@@ -512,6 +514,78 @@ static void writeTemplatePrefix(OutputList &ol, const ArgumentList &argList)
    ol.docify("> ");
 }
 
+// data used by only a few members, allocated the first time one of the fields is set
+struct MemberDefColdData {
+   MemberDefColdData() : groupStartLine(0) {}
+
+   QString bitfields;                              // struct member bitfields
+   QString enumBaseType;                           // base type of the enum (C++11)
+
+   // copperspice properties
+   QString m_read;
+   QString m_write;
+   QString m_reset;
+   QString m_notify;
+
+   QString groupFileName;                          // file where this grouping was defined
+   int groupStartLine;                             // line where this grouping was defined
+
+   QSharedPointer<MemberDef> groupAlias;           // Member containing the definition
+
+   QMap<QSharedPointer<Definition>, QSharedPointer<MemberList>> classSectionSDict;
+
+   QSharedPointer<ClassDef> cachedTypedefValue;
+   QString cachedTypedefTemplSpec;
+   QString cachedResolvedType;
+
+   // to store the output file base from tag files
+   QString explicitOutputFileBase;
+
+   // objective-c
+   QSharedPointer<ClassDef> category;
+   QSharedPointer<MemberDef> categoryRelation;
+};
+
+class MemberDefCold
+{
+ public:
+   MemberDefCold() = default;
+
+   MemberDefCold(const MemberDefCold &other)
+      : m_data(other.m_data ? new MemberDefColdData(*other.m_data) : nullptr)
+   { }
+
+   MemberDefCold &operator=(const MemberDefCold &other) {
+      if (this != &other) {
+         m_data.reset(other.m_data ? new MemberDefColdData(*other.m_data) : nullptr);
+      }
+
+      return *this;
+   }
+
+   // read access, returns an empty instance when nothing was stored
+   const MemberDefColdData &get() const {
+      static const MemberDefColdData emptyData;
+      return m_data ? *m_data : emptyData;
+   }
+
+   // write access, allocates the data on first use
+   MemberDefColdData &set() {
+      if (m_data == nullptr) {
+         m_data.reset(new MemberDefColdData);
+      }
+
+      return *m_data;
+   }
+
+   bool isAllocated() const {
+      return m_data != nullptr;
+   }
+
+ private:
+   std::unique_ptr<MemberDefColdData> m_data;
+};
+
 class MemberDefImpl
 {
  public:
@@ -529,7 +603,6 @@ class MemberDefImpl
    QSharedPointer<MemberDef>    enumScope;        // the enclosing scope, if this is an enum field
    QSharedPointer<MemberDef>    annEnumType;      // the anonymous enum that is the type of this member
 
-   bool livesInsideEnum;
    QSharedPointer<MemberList>   enumFields;       // enumeration fields
 
    QSharedPointer<MemberDef>    redefines;        // the parent member
@@ -554,18 +627,9 @@ class MemberDefImpl
    Protection prot;         // protection type [Public/Protected/Private]
 
    QString decl;            // member declaration in class
-   QString bitfields;       // struct member bitfields
-
-   // copperspice properties
-   QString m_read;
-   QString m_write;
-   QString m_reset;
-   QString m_notify;
-
    QString exception;                // exceptions that can be thrown
-   QString initializer;
+   SpillText initializer;
    QString extraTypeChars;           // extra type info found after the argument list
-   QString enumBaseType;             // base type of the enum (C++11)
    int initLines;                    // number of lines in the initializer
 
    Entry::Traits m_memberTraits;     // specifiers for this member
@@ -590,57 +654,43 @@ class MemberDefImpl
    // getClassDefOfAnonymousType() and cached here
    QSharedPointer<ClassDef> cachedAnonymousType;
 
-   QMap<QSharedPointer<Definition>, QSharedPointer<MemberList>> classSectionSDict;
-
-   QSharedPointer<MemberDef> groupAlias;           // Member containing the definition
-
    int grpId;                                      // group id
    QSharedPointer<MemberGroup> memberGroup;        // group's member definition
    QSharedPointer<GroupDef> group;                 // group in which this member is in
    Grouping::GroupPri_t grouppri;                  // priority of this definition
 
-   QString groupFileName;                          // file where this grouping was defined
-   int groupStartLine;                             // line where this grouping was defined
-
    QSharedPointer<MemberDef> groupMember;
 
-   bool isTypedefValCached;
-   QSharedPointer<ClassDef> cachedTypedefValue;
-   QString cachedTypedefTemplSpec;
-   QString cachedResolvedType;
-
    // documentation inheritance
    QSharedPointer<MemberDef> docProvider;
 
-   // to store the output file base from tag files
-   QString explicitOutputFileBase;
-
-   // objective-c
-   bool implOnly;            // function found in implementation but not in the interface
-   bool hasDocumentedParams;
-   bool hasDocumentedReturnType;
-   bool isDMember;
-
    Relationship m_related;   // relationship of this to the class
 
-   bool stat;                // is it a static function?
-   bool proto;               // is it a prototype;
-   bool docEnumValues;       // is an enum with documented enum values
-   bool annScope;            // member is part of an anonymous scope
-   bool annUsed;
-   bool hasCallGraph;
-   bool hasCallerGraph;
-   bool explExt;             // member was explicitly declared external
-   bool tspec;               // member is a template specialization
-   bool groupHasDocs;        // true if the entry that caused the grouping was documented
-   bool docsForDefinition;   // true => documentation block is put before definition.
-
-   QSharedPointer<ClassDef> category;
-   QSharedPointer<MemberDef> categoryRelation;
+   // flags, packed into bit fields
+   bool livesInsideEnum : 1;
+   bool isTypedefValCached : 1;
+   bool implOnly : 1;                     // function found in implementation but not in the interface (objective-c)
+   bool hasDocumentedParams : 1;
+   bool hasDocumentedReturnType : 1;
+   bool isDMember : 1;                    // member of a D source file
+   bool stat : 1;                         // is it a static function?
+   bool proto : 1;                        // is it a prototype
+   bool docEnumValues : 1;                // is an enum with documented enum values
+   bool annScope : 1;                     // member is part of an anonymous scope
+   bool annUsed : 1;
+   bool hasCallGraph : 1;
+   bool hasCallerGraph : 1;
+   bool explExt : 1;                      // member was explicitly declared external
+   bool tspec : 1;                        // member is a template specialization
+   bool groupHasDocs : 1;                 // true if the entry that caused the grouping was documented
+   bool docsForDefinition : 1;            // true => documentation block is put before definition
+
+   // fields which are rarely set, allocated on first use
+   MemberDefCold cold;
 };
 
 MemberDefImpl::MemberDefImpl() :
-   enumFields(0), redefinedBy(0), category(0), categoryRelation(0)
+   enumFields(0), redefinedBy(0)
 { }
 
 MemberDefImpl::~MemberDefImpl()
@@ -693,7 +743,6 @@ void MemberDefImpl::init(Definition *def, const QString &type, const QString &a,
    m_memberTraits = Entry::Traits{};
 
    annEnumType = QSharedPointer<MemberDef>();
-   groupAlias  = QSharedPointer<MemberDef>();
 
    explExt = false;
    tspec   = false;
@@ -719,15 +768,12 @@ void MemberDefImpl::init(Definition *def, const QString &type, const QString &a,
 
    templateMaster = QSharedPointer<MemberDef>();
 
-   classSectionSDict.clear();
-
    docsForDefinition       = true;
    isTypedefValCached      = false;
    implOnly                = false;
    hasDocumentedParams     = false;
    hasDocumentedReturnType = false;
 
-   cachedTypedefValue = QSharedPointer<ClassDef>();
    groupMember        = QSharedPointer<MemberDef>();
    docProvider        = QSharedPointer<MemberDef>();
 
@@ -794,8 +840,6 @@ QSharedPointer<MemberDef> MemberDef::deepCopy() const
    result->m_impl->m_typeConstraints         = m_impl->m_typeConstraints;
    result->m_impl->m_defaultTemplateArgLists = m_impl->m_defaultTemplateArgLists;
 
-   result->m_impl->classSectionSDict = m_impl->classSectionSDict;
-
    return result;
 }
 
@@ -907,8 +951,8 @@ QString MemberDef::getOutputFileBase() const
 
    QString baseName;
 
-   if (! m_impl->explicitOutputFileBase.isEmpty()) {
-      return m_impl->explicitOutputFileBase;
+   if (! m_impl->cold.get().explicitOutputFileBase.isEmpty()) {
+      return m_impl->cold.get().explicitOutputFileBase;
 
    } else if (m_impl->templateMaster) {
       return m_impl->templateMaster->getOutputFileBase();
@@ -979,8 +1023,8 @@ QString MemberDef::anchor() const
 {
    QString result = m_impl->anc;
 
-   if (m_impl->groupAlias) {
-      return m_impl->groupAlias->anchor();
+   if (m_impl->cold.get().groupAlias) {
+      return m_impl->cold.get().groupAlias->anchor();
    }
 
    if (m_impl->templateMaster) {
@@ -1640,20 +1684,20 @@ void MemberDef::writeDeclaration(OutputList &ol, QSharedPointer<ClassDef> cd, QS
    }
 
    // *** write bitfields
-   if (! m_impl->bitfields.isEmpty()) {
+   if (! m_impl->cold.get().bitfields.isEmpty()) {
       // add bitfields
-      linkifyText(TextGeneratorOLImpl(ol), d, getBodyDef(), self, m_impl->bitfields);
+      linkifyText(TextGeneratorOLImpl(ol), d, getBodyDef(), self, m_impl->cold.get().bitfields);
 
    } else if (hasOneLineInitializer() ) {
       // add initializer
 
       if (! isDefine()) {
          ol.writeString(" ");
-         linkifyText(TextGeneratorOLImpl(ol), d, getBodyDef(), self, m_impl->initializer.simplified());
+         linkifyText(TextGeneratorOLImpl(ol), d, getBodyDef(), self, m_impl->initializer.text().simplified());
 
       } else {
          ol.writeNonBreakableSpace(3);
-         linkifyText(TextGeneratorOLImpl(ol), d, getBodyDef(), self, m_impl->initializer);
+         linkifyText(TextGeneratorOLImpl(ol), d, getBodyDef(), self, m_impl->initializer.text());
       }
 
    } else if (isAlias()) {
@@ -1763,14 +1807,14 @@ void MemberDef::writeDeclaration(OutputList &ol, QSharedPointer<ClassDef> cd, QS
    // write brief description
    if (! briefDescription().isEmpty() && briefMemberDesc) {
 
-      DocRoot *rootNode = validatingParseDoc(briefFile(), briefLine(), getOuterScope() ? getOuterScope() : d,
+      QSharedPointer<DocRoot> rootNode = sharedParseDoc(briefFile(), briefLine(), getOuterScope() ? getOuterScope() : d,
                   self, briefDescription(), true, false, "", true, false);
 
       if (rootNode && ! rootNode->isEmpty()) {
          ol.startMemberDescription(anchor(), inheritId);
 
          // write the brief description
-         ol.writeDoc(rootNode, getOuterScope() ? getOuterScope() : d, self);
+         ol.writeDoc(rootNode.data(), getOuterScope() ? getOuterScope() : d, self);
 
          if (detailsVisible) {
 
@@ -1805,7 +1849,6 @@ void MemberDef::writeDeclaration(OutputList &ol, QSharedPointer<ClassDef> cd, QS
          ol.popGeneratorState();
          ol.endMemberDescription();
       }
-      delete rootNode;
    }
 
    ol.endMemberDeclaration(anchor(), inheritId);
@@ -2390,12 +2433,12 @@ void MemberDef::_writeCategoryRelation(OutputList &ol)
 
       int i = -1;
 
-      if (m_impl->categoryRelation && m_impl->categoryRelation->isLinkable()) {
-         if (m_impl->category) {
+      if (m_impl->cold.get().categoryRelation && m_impl->cold.get().categoryRelation->isLinkable()) {
+         if (m_impl->cold.get().category) {
             // this member is in a normal class and implements method categoryRelation from category
             // so link to method 'categoryRelation' with 'provided by category 'category' text.
             text = theTranslator->trProvidedByCategory();
-            name = m_impl->category->displayName();
+            name = m_impl->cold.get().category->displayName();
 
          } else if (m_impl->classDef->categoryOf()) {
             // this member is part of a category so link to the corresponding class member of the class we extend
@@ -2407,7 +2450,7 @@ void MemberDef::_writeCategoryRelation(OutputList &ol)
          i = text.indexOf("@1");
 
          if (i != -1) {
-            QSharedPointer<MemberDef> md = m_impl->categoryRelation;
+            QSharedPointer<MemberDef> md = m_impl->cold.get().categoryRelation;
 
             ref  = md->getReference();
             file = md->getOutputFileBase();
@@ -2521,8 +2564,8 @@ QString MemberDef::displayDefinition() const
       if (! title.isEmpty() && title.at(0) == '@') {
          ldef = title = "anonymous enum";
 
-         if (!m_impl->enumBaseType.isEmpty()) {
-            ldef += " : " + m_impl->enumBaseType;
+         if (!m_impl->cold.get().enumBaseType.isEmpty()) {
+            ldef += " : " + m_impl->cold.get().enumBaseType;
          }
 
       } else {
@@ -2755,8 +2798,8 @@ void MemberDef::writeDocumentation(QSharedPointer<MemberList> ml, OutputList &ol
       if (title.at(0) == '@') {
          ldef = title = "anonymous enum";
 
-         if (! m_impl->enumBaseType.isEmpty()) {
-            ldef += " : " + m_impl->enumBaseType;
+         if (! m_impl->cold.get().enumBaseType.isEmpty()) {
+            ldef += " : " + m_impl->cold.get().enumBaseType;
          }
 
       } else {
@@ -2983,7 +3026,7 @@ void MemberDef::writeDocumentation(QSharedPointer<MemberList> ml, OutputList &ol
          if (! isDefine()) {
             ol.docify(" ");
 
-            QString init = m_impl->initializer.simplified();
+            QString init = m_impl->initializer.text().simplified();
             linkifyText(TextGeneratorOLImpl(ol), scopedContainer, getBodyDef(), self, init);
 
          } else {
@@ -2995,7 +3038,7 @@ void MemberDef::writeDocumentation(QSharedPointer<MemberList> ml, OutputList &ol
             }
 
             ol.writeNonBreakableSpace(3);
-            linkifyText(TextGeneratorOLImpl(ol), scopedContainer, getBodyDef(), self, m_impl->initializer);
+            linkifyText(TextGeneratorOLImpl(ol), scopedContainer, getBodyDef(), self, m_impl->initializer.text());
          }
       }
 
@@ -3130,11 +3173,11 @@ void MemberDef::writeDocumentation(QSharedPointer<MemberList> ml, OutputList &ol
 
       ol.startCodeFragment();
 
-      if (m_impl->initializer.startsWith("=")) {
-         m_impl->initializer = m_impl->initializer.mid(1).trimmed();
+      if (m_impl->initializer.text().startsWith("=")) {
+         m_impl->initializer = m_impl->initializer.text().mid(1).trimmed();
       }
 
-      pIntf->parseCode(ol, scopeName, m_impl->initializer, lang, false, 0, getFileDef(), -1, -1, true, self, false, self);
+      pIntf->parseCode(ol, scopeName, m_impl->initializer.text(), lang, false, 0, getFileDef(), -1, -1, true, self, false, self);
       ol.endCodeFragment();
    }
 
@@ -3384,8 +3427,8 @@ void MemberDef::writeMemberDocSimple(OutputList &ol, QSharedPointer<Definition>
       linkifyText(TextGeneratorOLImpl(ol), getOuterScope(), getBodyDef(), self, argsString());
    }
 
-   if (! m_impl->bitfields.isEmpty()) { // add bitfields
-      linkifyText(TextGeneratorOLImpl(ol), getOuterScope(), getBodyDef(), self, m_impl->bitfields);
+   if (! m_impl->cold.get().bitfields.isEmpty()) { // add bitfields
+      linkifyText(TextGeneratorOLImpl(ol), getOuterScope(), getBodyDef(), self, m_impl->cold.get().bitfields);
    }
    ol.endInlineMemberName();
 
@@ -3410,6 +3453,54 @@ void MemberDef::writeMemberDocSimple(OutputList &ol, QSharedPointer<Definition>
    ol.endInlineMemberDoc();
 }
 
+void MemberDef::printMemoryUsage()
+{
+   struct MemoryUsage {
+      MemoryUsage() : count(0), coldCount(0), bytes(0) {}
+
+      long long count;
+      long long coldCount;
+      long long bytes;
+   };
+
+   // key is the kind of member
+   QMap<QString, MemoryUsage> usage;
+
+   auto collect = [&usage] (const MemberNameSDict &dict) {
+      for (auto mn : dict) {
+         for (auto md : *mn) {
+            const MemberDefImpl *impl = md->m_impl.data();
+            MemoryUsage &item = usage[md->memberTypeName()];
+
+            item.count++;
+            item.bytes += sizeof(MemberDef) + sizeof(MemberDefImpl);
+
+            // string data is stored as UTF-8
+            item.bytes += impl->m_type.size_storage() + impl->m_args.size_storage() + impl->def.size_storage() +
+                  impl->anc.size_storage() + impl->decl.size_storage() + impl->initializer.residentSize();
+
+            if (impl->cold.isAllocated()) {
+               item.coldCount++;
+               item.bytes += sizeof(MemberDefColdData);
+            }
+         }
+      }
+   };
+
+   collect(Doxy_Globals::memberNameSDict);
+   collect(Doxy_Globals::functionNameSDict);
+
+   msg("Member memory usage, hot part %d bytes, cold part %d bytes\n", (int)sizeof(MemberDefImpl),
+                  (int)sizeof(MemberDefColdData));
+
+   for (auto iter = usage.begin(); iter != usage.end(); ++iter) {
+      const MemoryUsage &item = iter.value();
+
+      msg("   %-20s %10lld members  %10lld with cold data  %12lld bytes  %8lld bytes per member\n",
+                  csPrintable(iter.key()), item.count, item.coldCount, item.bytes, item.bytes / item.count);
+   }
+}
+
 QString MemberDef::memberTypeName() const
 {
    QString retval;
@@ -3695,8 +3786,11 @@ void MemberDef::setGroupDef(QSharedPointer<GroupDef> gd, Grouping::GroupPri_t pr
 {
    m_impl->group = gd;
    m_impl->grouppri = pri;
-   m_impl->groupFileName  = fileName;
-   m_impl->groupStartLine = startLine;
+   if (! fileName.isEmpty() || m_impl->cold.isAllocated()) {
+      m_impl->cold.set().groupFileName  = fileName;
+      m_impl->cold.set().groupStartLine = startLine;
+   }
+
    m_impl->groupHasDocs = hasDocs;
    m_impl->groupMember  = member;
    m_isLinkableCached   = 0;
@@ -3710,8 +3804,8 @@ void MemberDef::setEnumScope(QSharedPointer<MemberDef> md, bool livesInsideEnum)
    if (md->getGroupDef()) {
       m_impl->group = md->getGroupDef();
       m_impl->grouppri = md->getGroupPri();
-      m_impl->groupFileName = md->getGroupFileName();
-      m_impl->groupStartLine = md->getGroupStartLine();
+      m_impl->cold.set().groupFileName = md->getGroupFileName();
+      m_impl->cold.set().groupStartLine = md->getGroupStartLine();
       m_impl->groupHasDocs = md->getGroupHasDocs();
       m_isLinkableCached = 0;
    }
@@ -3782,17 +3876,19 @@ bool MemberDef::hasMultiLineInitializer() const
 
 void MemberDef::setInitializer(const QString &initializer)
 {
-   m_impl->initializer = initializer;
+   QString init = initializer;
 
-   int max = m_impl->initializer.length();
+   int max = init.length();
    int p   = max - 1;
 
-   while (p >= 0 && m_impl->initializer.at(p).isSpace() ) {
+   while (p >= 0 && init.at(p).isSpace() ) {
       --p;
    }
 
-   m_impl->initializer = m_impl->initializer.left(p + 1);
-   m_impl->initLines   = m_impl->initializer.count('\n');
+   init = init.left(p + 1);
+
+   m_impl->initializer = init;
+   m_impl->initLines   = init.count('\n');
 }
 
 void MemberDef::addListReference(QSharedPointer<Definition> def)
@@ -3859,12 +3955,12 @@ void MemberDef::addListReference(QSharedPointer<Definition> def)
 
 QSharedPointer<MemberList> MemberDef::getSectionList(QSharedPointer<Definition> d) const
 {
-   return m_impl->classSectionSDict.value(d);
+   return m_impl->cold.get().classSectionSDict.value(d);
 }
 
 void MemberDef::setSectionList(QSharedPointer<Definition> d, QSharedPointer<MemberList> sl)
 {
-   m_impl->classSectionSDict.insert(d, sl);
+   m_impl->cold.set().classSectionSDict.insert(d, sl);
 }
 
 Specifier MemberDef::virtualness(int count) const
@@ -4147,10 +4243,10 @@ void MemberDef::writeEnumDeclaration(OutputList &typeDecl, QSharedPointer<ClassD
       typeDecl.writeChar(' ');
    }
 
-   if (!m_impl->enumBaseType.isEmpty()) {
+   if (!m_impl->cold.get().enumBaseType.isEmpty()) {
       typeDecl.writeChar(':');
       typeDecl.writeChar(' ');
-      typeDecl.docify(m_impl->enumBaseType);
+      typeDecl.docify(m_impl->cold.get().enumBaseType);
       typeDecl.writeChar(' ');
    }
 
@@ -4339,7 +4435,7 @@ void MemberDef::setTagInfo(const TagInfo &tag)
    if (! tag.isEmpty()) {
       m_impl->anc = tag.tag_Anchor;
       setReference(tag.tag_Name);
-      m_impl->explicitOutputFileBase = stripExtension(tag.tag_FileName);
+      m_impl->cold.set().explicitOutputFileBase = stripExtension(tag.tag_FileName);
    }
 }
 
@@ -4398,12 +4494,12 @@ QString MemberDef::excpString() const
 
 QString MemberDef::bitfieldString() const
 {
-   return m_impl->bitfields;
+   return m_impl->cold.get().bitfields;
 }
 
 QString MemberDef::initializer() const
 {
-   return m_impl->initializer;
+   return m_impl->initializer.text();
 }
 
 int MemberDef::initializerLines() const
@@ -4433,22 +4529,22 @@ QSharedPointer<NamespaceDef> MemberDef::getNamespaceDef() const
 
 QString MemberDef::getPropertyRead() const
 {
-   return m_impl->m_read;
+   return m_impl->cold.get().m_read;
 }
 
 QString MemberDef::getPropertyWrite() const
 {
-   return m_impl->m_write;
+   return m_impl->cold.get().m_write;
 }
 
 QString MemberDef::getPropertyReset() const
 {
-   return m_impl->m_reset;
+   return m_impl->cold.get().m_reset;
 }
 
 QString MemberDef::getPropertyNotify() const
 {
-   return m_impl->m_notify;
+   return m_impl->cold.get().m_notify;
 }
 
 QSharedPointer<GroupDef> MemberDef::getGroupDef() const
@@ -4463,12 +4559,12 @@ Grouping::GroupPri_t MemberDef::getGroupPri() const
 
 QString MemberDef::getGroupFileName() const
 {
-   return m_impl->groupFileName;
+   return m_impl->cold.get().groupFileName;
 }
 
 int MemberDef::getGroupStartLine() const
 {
-   return m_impl->groupStartLine;
+   return m_impl->cold.get().groupStartLine;
 }
 
 bool MemberDef::getGroupHasDocs() const
@@ -5002,17 +5098,17 @@ bool MemberDef::isTypedefValCached() const
 
 QSharedPointer<ClassDef> MemberDef::getCachedTypedefVal() const
 {
-   return m_impl->cachedTypedefValue;
+   return m_impl->cold.get().cachedTypedefValue;
 }
 
 QString MemberDef::getCachedTypedefTemplSpec() const
 {
-   return m_impl->cachedTypedefTemplSpec;
+   return m_impl->cold.get().cachedTypedefTemplSpec;
 }
 
 QString MemberDef::getCachedResolvedTypedef() const
 {
-   return m_impl->cachedResolvedType;
+   return m_impl->cold.get().cachedResolvedType;
 }
 
 QSharedPointer<MemberDef> MemberDef::memberDefinition() const
@@ -5032,7 +5128,7 @@ QSharedPointer<MemberDef> MemberDef::inheritsDocsFrom() const
 
 QSharedPointer<MemberDef> MemberDef::getGroupAlias() const
 {
-   return m_impl->groupAlias;
+   return m_impl->cold.get().groupAlias;
 }
 
 void MemberDef::setMemberType(MemberDefType t)
@@ -5072,7 +5168,9 @@ void MemberDef::mergeMemberTraits(Entry::Traits traits)
 
 void MemberDef::setBitfields(const QString &s)
 {
-   m_impl->bitfields = s.simplified();
+   if (! s.isEmpty() || m_impl->cold.isAllocated()) {
+      m_impl->cold.set().bitfields = s.simplified();
+   }
 }
 
 void MemberDef::setMaxInitLines(int lines)
@@ -5089,22 +5187,30 @@ void MemberDef::setExplicitExternal(bool b)
 
 void MemberDef::setPropertyRead(const QString &data)
 {
-   m_impl->m_read = data;
+   if (! data.isEmpty() || m_impl->cold.isAllocated()) {
+      m_impl->cold.set().m_read = data;
+   }
 }
 
 void MemberDef::setPropertyWrite(const QString &data)
 {
-   m_impl->m_write = data;
+   if (! data.isEmpty() || m_impl->cold.isAllocated()) {
+      m_impl->cold.set().m_write = data;
+   }
 }
 
 void MemberDef::setPropertyReset(const QString &data)
 {
-   m_impl->m_reset = data;
+   if (! data.isEmpty() || m_impl->cold.isAllocated()) {
+      m_impl->cold.set().m_reset = data;
+   }
 }
 
 void MemberDef::setPropertyNotify(const QString &data)
 {
-   m_impl->m_notify = data;
+   if (! data.isEmpty() || m_impl->cold.isAllocated()) {
+      m_impl->cold.set().m_notify = data;
+   }
 }
 
 void MemberDef::setTemplateSpecialization(bool b)
@@ -5222,7 +5328,9 @@ void MemberDef::setDocsForDefinition(bool b)
 
 void MemberDef::setGroupAlias(QSharedPointer<MemberDef> md)
 {
-   m_impl->groupAlias = md;
+   if (md != nullptr || m_impl->cold.isAllocated()) {
+      m_impl->cold.set().groupAlias = md;
+   }
 }
 
 void MemberDef::invalidateTypedefValCache()
@@ -5242,40 +5350,47 @@ void MemberDef::setMemberDeclaration(QSharedPointer<MemberDef> md)
 
 QSharedPointer<ClassDef> MemberDef::category() const
 {
-   return m_impl->category;
+   return m_impl->cold.get().category;
 }
 
 void MemberDef::setCategory(QSharedPointer<ClassDef> def)
 {
-   m_impl->category = def;
+   if (def != nullptr || m_impl->cold.isAllocated()) {
+      m_impl->cold.set().category = def;
+   }
 }
 
 QSharedPointer<MemberDef> MemberDef::categoryRelation() const
 {
-   return m_impl->categoryRelation;
+   return m_impl->cold.get().categoryRelation;
 }
 
 void MemberDef::setCategoryRelation(QSharedPointer<MemberDef> md)
 {
-   m_impl->categoryRelation = md;
+   if (md != nullptr || m_impl->cold.isAllocated()) {
+      m_impl->cold.set().categoryRelation = md;
+   }
 }
 
 void MemberDef::setEnumBaseType(const QString &type)
 {
-   m_impl->enumBaseType = type;
+   if (! type.isEmpty() || m_impl->cold.isAllocated()) {
+      m_impl->cold.set().enumBaseType = type;
+   }
 }
 
 QString MemberDef::enumBaseType() const
 {
-   return m_impl->enumBaseType;
+   return m_impl->cold.get().enumBaseType;
 }
 
 void MemberDef::cacheTypedefVal(QSharedPointer<ClassDef> val, const QString &templSpec, const QString &resolvedType)
 {
    m_impl->isTypedefValCached = true;
-   m_impl->cachedTypedefValue = val;
-   m_impl->cachedTypedefTemplSpec = templSpec;
-   m_impl->cachedResolvedType = resolvedType;
+   MemberDefColdData &data = m_impl->cold.set();
+   data.cachedTypedefValue     = val;
+   data.cachedTypedefTemplSpec = templSpec;
+   data.cachedResolvedType     = resolvedType;
 }
 
 void MemberDef::copyArgumentNames(QSharedPointer<MemberDef> bmd)
@@ -5312,7 +5427,8 @@ void MemberDef::copyArgumentNames(QSharedPointer<MemberDef> bmd)
 static void invalidateCachedTypesInArgumentList(ArgumentList &al)
 {
    for (auto &a : al) {
-      a.canType = "";
+      a.canType    = "";
+      a.canTypeKey = "";
    }
 }
 
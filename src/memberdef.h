@@ -112,6 +112,9 @@ class MemberDef : public Definition
    MemberDefType memberType() const;
    QString memberTypeName() const;
 
+   // print the memory used per member kind, debug flag memory
+   static void printMemoryUsage();
+
    // get methods
    bool isSignal() const;
    bool isSlot() const;
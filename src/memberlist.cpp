@@ -383,12 +383,12 @@ void MemberList::writePlainDeclarations(OutputList &ol, QSharedPointer<ClassDef>
 
                   if (! md->briefDescription().isEmpty() && briefMemberDesc) {
 
-                     DocRoot *rootNode = validatingParseDoc(md->briefFile(), md->briefLine(),
+                     QSharedPointer<DocRoot> rootNode = sharedParseDoc(md->briefFile(), md->briefLine(),
                                             cd, md, md->briefDescription(), true, false, "", true, false);
 
                      if (rootNode && ! rootNode->isEmpty()) {
                         ol.startMemberDescription(md->anchor());
-                        ol.writeDoc(rootNode, cd, md);
+                        ol.writeDoc(rootNode.data(), cd, md);
 
                         if (md->isDetailedSectionLinkable()) {
                            ol.disableAllBut(OutputGenerator::Html);
@@ -400,7 +400,6 @@ void MemberList::writePlainDeclarations(OutputList &ol, QSharedPointer<ClassDef>
                         }
                         ol.endMemberDescription();
                      }
-                     delete rootNode;
                   }
 
                   ol.endMemberDeclaration(md->anchor(), inheritId);
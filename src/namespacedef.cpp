@@ -109,7 +109,9 @@ void NamespaceDef::insertUsedFile(QSharedPointer<FileDef> fd)
       return;
    }
 
-   if (! files.contains(fd)) {
+   if (! m_usedFiles.contains(fd.data())) {
+      m_usedFiles.insert(fd.data());
+
       if (sortMemberDocs) {
          files.inSort(fd);
 
@@ -379,8 +381,8 @@ void NamespaceDef::writeBriefDescription(OutputList &ol)
    QSharedPointer<NamespaceDef> self = sharedFrom(this);
 
    if (hasBriefDescription()) {
-      DocRoot *rootNode = validatingParseDoc(briefFile(), briefLine(), self, QSharedPointer<MemberDef>(),
-                                             briefDescription(), true, false, "", true, false);
+      QSharedPointer<DocRoot> rootNode = sharedParseDoc(briefFile(), briefLine(), self, QSharedPointer<MemberDef>(),
+                                                       briefDescription(), true, false, "", true, false);
 
       if (rootNode && ! rootNode->isEmpty()) {
          ol.startParagraph();
@@ -390,7 +392,7 @@ void NamespaceDef::writeBriefDescription(OutputList &ol)
          ol.writeString(" - ");
          ol.popGeneratorState();
 
-         ol.writeDoc(rootNode, self, QSharedPointer<MemberDef>());
+         ol.writeDoc(rootNode.data(), self, QSharedPointer<MemberDef>());
          ol.pushGeneratorState();
          ol.disable(OutputGenerator::RTF);
          ol.writeString(" \n");
@@ -405,7 +407,6 @@ void NamespaceDef::writeBriefDescription(OutputList &ol)
          ol.popGeneratorState();
          ol.endParagraph();
       }
-      delete rootNode;
 
       // FIXME:PARA
       //ol.pushGeneratorState();
@@ -20,6 +20,7 @@
 #define NAMESPACEDEF_H
 
 #include <QHash>
+#include <QSet>
 #include <QStringList>
 #include <QSharedPointer>
 #include <QTextStream>
@@ -172,6 +173,9 @@ class NamespaceDef : public Definition
    QString  fileName;
    FileList files;
 
+   // membership test for files, large namespaces are declared in many files
+   QSet<const FileDef *> m_usedFiles;
+
    StringMap<QSharedPointer<Definition>>  m_usingDeclMap;
    StringMap<QSharedPointer<Definition>>  m_innerCompounds;
 
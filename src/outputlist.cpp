@@ -120,16 +120,12 @@ bool OutputList::generateDoc(const QString &fileName, int startLine, QSharedPoin
    }
 
 
-   DocRoot *root = nullptr;
-   root = validatingParseDoc(fileName, startLine, ctx, md, docStr, indexWords, isExample,
+   QSharedPointer<DocRoot> root = sharedParseDoc(fileName, startLine, ctx, md, docStr, indexWords, isExample,
                   exampleName, singleLine, linkFromIndex);
 
-   writeDoc(root, ctx, md);
+   writeDoc(root.data(), ctx, md);
 
-   bool isEmpty = root->isEmpty();
-   delete root;
-
-   return isEmpty;
+   return root->isEmpty();
 }
 
 void OutputList::writeDoc(DocRoot *root, QSharedPointer<Definition> ctx, QSharedPointer<MemberDef> md)
@@ -19,9 +19,16 @@
 #include <QRegularExpression>
 #include <QFileInfo>
 #include <QHash>
+#include <QThread>
 
 #include <stdio.h>
 
+#include <algorithm>
+#include <atomic>
+#include <future>
+#include <mutex>
+#include <vector>
+
 #include <parse_md.h>
 
 #include <config.h>
@@ -43,10 +50,41 @@ struct LinkRef {
 
 enum Alignment { AlignNone, AlignLeft, AlignCenter, AlignRight };
 
-static QHash<QString, LinkRef> g_linkRefs;
-static QSharedPointer<Entry>   g_current;
-static QString                 g_fileName;
-static int                     g_lineNr;
+struct MarkdownSection {
+   QString id;
+   QString header;
+   SectionInfo::SectionType type;
+   int level;
+};
+
+// standalone page converted by MarkdownFileParser::prefetchPages()
+struct MarkdownPage {
+   QString docs;                          // page text passed to the comment scanner
+   QString output;                        // markdown converted docs
+   QVector<MarkdownSection> sections;     // sections to register when the page is parsed
+   int autoIdCount = 0;                   // number of generated section ids
+};
+
+// conversion state, each thread converting markdown has its own copy
+static thread_local QHash<QString, LinkRef> g_linkRefs;
+static thread_local QSharedPointer<Entry>   g_current;
+static thread_local QString                 g_fileName;
+static thread_local int                     g_lineNr;
+
+// set while a page is converted ahead of time, sections and generated ids are recorded
+static thread_local MarkdownPage *g_deferred = nullptr;
+
+// generated ids are replaced by placeholders while deferred, numbered when the page is parsed
+static const QChar autoIdStart = QChar(U'\uE000');
+static const QChar autoIdEnd   = QChar(U'\uE001');
+
+static int g_autoId = 0;
+
+static QHash<QString, MarkdownPage> g_prefetchedPages;    // keyed by file name
+static MarkdownPage                 g_pendingPage;         // prefetched page currently being parsed
+static QString                      g_pendingFileName;
+
+static std::mutex g_findFileMutex;
 
 // If a markdown page starts with a level1 header, this header is used as a title of the page.
 // This makes it a level0 header. So the level of all other sections will need to be corrected.
@@ -1089,7 +1127,13 @@ static int processLink(QString &out, QStringView data, QString::const_iterator i
       bool ambig;
       QSharedPointer<FileDef> fd;
 
-      if (link.contains("@ref ") || link.contains("\\ref ") || (fd = findFileDef(&Doxy_Globals::imageNameDict, link, ambig))) {
+      if (! link.contains("@ref ") && ! link.contains("\\ref ")) {
+         // lookup cache is shared with pages converted on other threads
+         std::lock_guard<std::mutex> lock(g_findFileMutex);
+         fd = findFileDef(&Doxy_Globals::imageNameDict, link, ambig);
+      }
+
+      if (link.contains("@ref ") || link.contains("\\ref ") || fd) {
          // assume DoxyPress symbol link or local image link
 
          out += "@image html ";
@@ -1345,20 +1389,18 @@ static void processInline(QString &out, const QStringView processText, QString::
    QString::const_iterator iter_i      = processText.constBegin();
    QString::const_iterator iter_index  = processText.constBegin();
 
-   static QSet<QChar> keys;
-
-   if (keys.isEmpty()) {
-      keys.insert('_');   // processEmphasis
-      keys.insert('*');   // processEmphasis
-      keys.insert('`');   // processCodeSpan
-      keys.insert('\\');  // processSpecialCommand
-      keys.insert('@');   // processSpecialCommand
-      keys.insert('[');   // processLink
-      keys.insert('!');   // processLink
-      keys.insert('<');   // processHtmlTag
-      keys.insert('-');   // processNmdash
-      keys.insert('"');   // processQuoted
-   }
+   static const QSet<QChar> keys = {
+      '_',     // processEmphasis
+      '*',     // processEmphasis
+      '`',     // processCodeSpan
+      '\\',    // processSpecialCommand
+      '@',     // processSpecialCommand
+      '[',     // processLink
+      '!',     // processLink
+      '<',     // processHtmlTag
+      '-',     // processNmdash
+      '"',     // processQuoted
+   };
 
    while (iter_i < iter_size) {
 
@@ -1723,7 +1765,7 @@ static QString extractTitleId(QString &title, int level)
 {
    static const int tocIncHeaders = Config::getInt("toc-include-headers");
 
-   static QRegularExpression regExp("\\{#[a-z_A-Z][a-z_A-Z0-9\\-]*\\}");
+   static const QRegularExpression regExp("\\{#[a-z_A-Z][a-z_A-Z0-9\\-]*\\}");
    QRegularExpressionMatch match = regExp.match(title);
 
    QString retval;
@@ -1742,10 +1784,16 @@ static QString extractTitleId(QString &title, int level)
    }
 
    if ((level > 0) && (level <= tocIncHeaders)) {
-      static int autoId = 0;
 
-      QString id = QString("autotoc_md%1").formatArg(autoId);
-      ++autoId;
+      if (g_deferred != nullptr) {
+         QString id = QString("autotoc_md") + autoIdStart + QString::number(g_deferred->autoIdCount) + autoIdEnd;
+         ++g_deferred->autoIdCount;
+
+         return id;
+      }
+
+      QString id = QString("autotoc_md%1").formatArg(g_autoId);
+      ++g_autoId;
 
       return id;
   }
@@ -2148,8 +2196,100 @@ QString::const_iterator findTableColumns(QStringView data, QString::const_iterat
    return iter_eol;
 }
 
+/** Properties of one line of the input of processBlocks(), computed once per line */
+struct LineInfo {
+   QString::const_iterator begin;          // first character of the line
+   QString::const_iterator end;            // one past the newline
+   QChar first;                            // first non space character, '\0' for a blank line
+   int   indent;                           // number of leading spaces
+   int   listIndent;                       // indent excluding list markers, -1 for a blank line
+
+   // table columns as reported by findTableColumns()
+   QString::const_iterator tableStart;
+   QString::const_iterator tableEnd;
+   QString::const_iterator tableNext;
+   int   columns;
+};
+
+static QVector<LineInfo> classifyLines(QStringView str)
+{
+   QVector<LineInfo> lines;
+
+   QString::const_iterator iter     = str.constBegin();
+   QString::const_iterator iter_end = str.constEnd();
+
+   while (iter != iter_end) {
+      LineInfo line;
+
+      line.begin  = iter;
+      line.end    = iter;
+      line.indent = 0;
+
+      while (line.end != iter_end && *line.end != '\n') {
+         ++line.end;
+      }
+
+      if (line.end != iter_end) {
+         ++line.end;
+      }
+
+      QString::const_iterator iter_text = iter;
+
+      while (iter_text != line.end && *iter_text == ' ') {
+         ++iter_text;
+         ++line.indent;
+      }
+
+      if (iter_text == line.end || *iter_text == '\n') {
+         line.first = '\0';
+      } else {
+         line.first = *iter_text;
+      }
+
+      QStringView text = QStringView(line.begin, line.end);
+
+      line.listIndent = computeIndentExcludingListMarkers(text);
+      line.tableNext  = findTableColumns(text, line.tableStart, line.tableEnd, line.columns);
+
+      lines.append(line);
+      iter = line.end;
+   }
+
+   return lines;
+}
+
+// returns the line which starts at iter, nullptr if iter is not at the start of a line
+static const LineInfo *lineAt(const QVector<LineInfo> &lines, QString::const_iterator iter)
+{
+   auto item = std::lower_bound(lines.constBegin(), lines.constEnd(), iter,
+         [] (const LineInfo &line, QString::const_iterator pos) { return line.begin < pos; });
+
+   if (item != lines.constEnd() && item->begin == iter) {
+      return &(*item);
+   }
+
+   return nullptr;
+}
+
+// same as findTableColumns(), uses the classified line when data starts at a line
+static QString::const_iterator tableColumns(const QVector<LineInfo> &lines, QStringView data,
+                  QString::const_iterator &iter_start, QString::const_iterator &iter_end, int &columns)
+{
+   const LineInfo *line = lineAt(lines, data.constBegin());
+
+   if (line == nullptr) {
+      return findTableColumns(data, iter_start, iter_end, columns);
+   }
+
+   iter_start = line->tableStart;
+   iter_end   = line->tableEnd;
+   columns    = line->columns;
+
+   return line->tableNext;
+}
+
 /** Returns true iff data points to the start of a table block */
-static bool isTableBlock(QStringView data)
+static bool isTableBlock(const QVector<LineInfo> &lines, QStringView data)
 {
    QString::const_iterator iter_size = data.constEnd();
    QString::const_iterator iter_i;
@@ -2163,13 +2303,13 @@ static bool isTableBlock(QStringView data)
    int cc2;
 
    // the first line should have at least two columns separated by '|'
-   iter_i = findTableColumns(data, iter_start, iter_end, cc0);
+   iter_i = tableColumns(lines, data, iter_start, iter_end, cc0);
 
    if (iter_i >= iter_size || cc0 < 1) {
       return false;
    }
 
-   iter_ret = findTableColumns(QStringView(iter_i, data.constEnd()), iter_start, iter_end, cc1);
+   iter_ret = tableColumns(lines, QStringView(iter_i, data.constEnd()), iter_start, iter_end, cc1);
    iter_j   = iter_start;
 
    // separator line should consist of |, - and : and spaces only
@@ -2189,12 +2329,12 @@ static bool isTableBlock(QStringView data)
       return false;
    }
 
-   findTableColumns(QStringView(iter_ret, data.constEnd()), iter_start, iter_end, cc2);
+   tableColumns(lines, QStringView(iter_ret, data.constEnd()), iter_start, iter_end, cc2);
 
    return cc1 == cc2;
 }
 
-static int writeTableBlock(QString &out, QStringView data)
+static int writeTableBlock(QString &out, const QVector<LineInfo> &lines, QStringView data)
 {
    QString::const_iterator iter_size = data.constEnd();
    QString::const_iterator iter_i    = data.constBegin();
@@ -2207,7 +2347,7 @@ static int writeTableBlock(QString &out, QStringView data)
    int columns;
    int cc;
 
-   iter_i = findTableColumns(QStringView(data.constBegin(), data.constEnd()), iter_start, iter_end, columns);
+   iter_i = tableColumns(lines, QStringView(data.constBegin(), data.constEnd()), iter_start, iter_end, columns);
 
    QString::const_iterator headerStart = iter_start;
    QString::const_iterator headerEnd   = iter_end;
@@ -2218,7 +2358,7 @@ static int writeTableBlock(QString &out, QStringView data)
    out += "<tr>";
 
    // read cell alignments
-   iter_ret = findTableColumns(QStringView(iter_i, data.constEnd()), iter_start, iter_end, cc);
+   iter_ret = tableColumns(lines, QStringView(iter_i, data.constEnd()), iter_start, iter_end, cc);
    k = 0;
 
    std::vector<Alignment> columnAlignment(columns);
@@ -2308,7 +2448,7 @@ static int writeTableBlock(QString &out, QStringView data)
 
    // write table cells
    while (iter_i < iter_size) {
-      iter_ret = findTableColumns(QStringView(iter_i, data.constEnd()), iter_start, iter_end, cc);
+      iter_ret = tableColumns(lines, QStringView(iter_i, data.constEnd()), iter_start, iter_end, cc);
 
       if (cc != columns) {
          break;   // end of table
@@ -2378,6 +2518,37 @@ static bool hasLineBreak(QStringView tmp)
    return false;
 }
 
+// registers a section found in a header, deferred pages record it until the page is parsed
+static void addSection(const QString &id, const QString &header, SectionInfo::SectionType type, int level)
+{
+   if (g_deferred != nullptr) {
+      g_deferred->sections.append(MarkdownSection{id, header, type, level});
+      return;
+   }
+
+   QSharedPointer<SectionInfo> si = Doxy_Globals::sectionDict.find(id);
+
+   if (si) {
+      if (si->lineNr != -1) {
+         warn(g_fileName, g_lineNr, "Multiple use of section label '%s', (first occurrence: %s, line %d)",
+             csPrintable(header), csPrintable(si->fileName), si->lineNr);
+
+      } else {
+         warn(g_fileName, g_lineNr, "Multiple use of section label '%s', (first occurrence: %s)",
+              csPrintable(header), csPrintable(si->fileName));
+      }
+
+   } else {
+      si = QSharedPointer<SectionInfo> (new SectionInfo(g_fileName, g_lineNr, id, header, type, level));
+
+      if (g_current) {
+         g_current->m_anchors.append(*si);
+      }
+
+      Doxy_Globals::sectionDict.insert(id, si);
+   }
+}
+
 void writeOneLineHeaderOrRuler(QString &out, QStringView data, QString::const_iterator iter_size)
 {
    int level;
@@ -2424,27 +2595,7 @@ void writeOneLineHeaderOrRuler(QString &out, QStringView data, QString::const_it
          out += header;
          out += "\n";
 
-         QSharedPointer<SectionInfo> si = Doxy_Globals::sectionDict.find(id);
-
-         if (si) {
-            if (si->lineNr != -1) {
-               warn(g_fileName, g_lineNr, "Multiple use of section label '%s', (first occurrence: %s, line %d)",
-                   csPrintable(header), csPrintable(si->fileName), si->lineNr);
-
-            } else {
-               warn(g_fileName, g_lineNr, "Multiple use of section label '%s', (first occurrence: %s)",
-                    csPrintable(header), csPrintable(si->fileName));
-            }
-
-         } else {
-            si = QSharedPointer<SectionInfo> (new SectionInfo(g_fileName, g_lineNr, id, header, type, level));
-
-            if (g_current) {
-               g_current->m_anchors.append(*si);
-            }
-
-            Doxy_Globals::sectionDict.insert(id, si);
-         }
+         addSection(id, header, type, level);
 
       } else {
          if (! id.isEmpty()) {
@@ -2869,15 +3020,24 @@ static QString processBlocks(QStringView str, int indent)
    int priorLine1_Indent  = -1;
    int currentLine_Indent = -1;
 
+   // classify every line once, the checks below only inspect lines which can start a block
+   const QVector<LineInfo> lines = classifyLines(str);
+
    // process each line
    while (iter_i < str.constEnd()) {
       findEndOfLine(retval, str, iter_prev, iter_i, iter_end);
 
       // line is now found at [i .. end - 1]
+      const LineInfo *curLine = lineAt(lines, iter_i);
 
       priorLine2_Indent  = priorLine1_Indent;
       priorLine1_Indent  = currentLine_Indent;
-      currentLine_Indent = computeIndentExcludingListMarkers(QStringView(iter_i, iter_end));
+
+      if (curLine != nullptr && curLine->end == iter_end) {
+         currentLine_Indent = curLine->listIndent;
+      } else {
+         currentLine_Indent = computeIndentExcludingListMarkers(QStringView(iter_i, iter_end));
+      }
 
       if (iter_prev != str.constEnd()) {
 
@@ -2887,7 +3047,13 @@ static QString processBlocks(QStringView str, int indent)
          QStringView s1 = QStringView(iter_prev, str.constEnd());
          QStringView s2 = QStringView(iter_i,    str.constEnd());
 
-         level = isHeaderline(QStringView(iter_i, str.constEnd()));
+         const LineInfo *prevLine = lineAt(lines, iter_prev);
+
+         if (curLine == nullptr || curLine->first == '=' || curLine->first == '-') {
+            level = isHeaderline(QStringView(iter_i, str.constEnd()));
+         } else {
+            level = 0;
+         }
 
          if (level > 0) {
 
@@ -2907,28 +3073,7 @@ static QString processBlocks(QStringView str, int indent)
                   retval += header;
                   retval += "\n\n";
 
-                  QSharedPointer<SectionInfo> si (Doxy_Globals::sectionDict.find(id));
-
-                  if (si != nullptr) {
-                     if (si->lineNr != -1) {
-                        warn(g_fileName, g_lineNr, "multiple use of section label '%s', (first occurrence: %s, line %d)",
-                             csPrintable(header), csPrintable(si->fileName), si->lineNr);
-
-                     } else {
-                        warn(g_fileName, g_lineNr, "multiple use of section label '%s', (first occurrence: %s)",
-                             csPrintable(header), csPrintable(si->fileName));
-                     }
-
-                  } else {
-                     si = QSharedPointer<SectionInfo> (new SectionInfo(g_fileName, g_lineNr, id, header,
-                                          level == 1 ? SectionInfo::Section : SectionInfo::Subsection, level));
-
-                     if (g_current) {
-                        g_current->m_anchors.append(*si);
-                     }
-
-                     Doxy_Globals::sectionDict.insert(id, si);
-                  }
+                  addSection(id, header, level == 1 ? SectionInfo::Section : SectionInfo::Subsection, level);
 
                } else {
                   retval += level == 1 ? "<h1>" : "<h2>";
@@ -2946,7 +3091,7 @@ static QString processBlocks(QStringView str, int indent)
 
             continue;
 
-         } else if ((ref = isLinkRef(s1, id, link, title))) {
+         } else if ((prevLine == nullptr || prevLine->first == '[') && (ref = isLinkRef(s1, id, link, title))) {
 
             g_linkRefs.insert(id.toLower(), LinkRef(link, title));
 
@@ -2954,7 +3099,8 @@ static QString processBlocks(QStringView str, int indent)
             iter_prev = str.constEnd();
             iter_end  = iter_i + 1;
 
-         } else if (isFencedCodeBlock(s1, indent, lang, iter_blockStart, iter_blockEnd, blockOffset)) {
+         } else if ((prevLine == nullptr || prevLine->first == '`' || prevLine->first == '~') &&
+                  isFencedCodeBlock(s1, indent, lang, iter_blockStart, iter_blockEnd, blockOffset)) {
 
             writeFencedCodeBlock(retval, s1, lang, iter_blockStart, iter_blockEnd);
             iter_i    = iter_prev + blockOffset;
@@ -2963,7 +3109,11 @@ static QString processBlocks(QStringView str, int indent)
             continue;
 
          } else {
-            bool isCB = isCodeBlock(s2, blockIndent, priorLine1_Indent, priorLine2_Indent);
+            bool isCB = false;
+
+            if (curLine == nullptr || (curLine->indent >= codeBlockIndent && curLine->first != '\0')) {
+               isCB = isCodeBlock(s2, blockIndent, priorLine1_Indent, priorLine2_Indent);
+            }
 
             if (isCB) {
                // skip previous line since it is empty
@@ -2973,9 +3123,9 @@ static QString processBlocks(QStringView str, int indent)
                iter_end  = iter_i + 1;
                continue;
 
-            } else if (isTableBlock(s1)) {
+            } else if ((prevLine == nullptr || prevLine->columns >= 1) && isTableBlock(lines, s1)) {
 
-               iter_i    = iter_prev + writeTableBlock(retval, s1);
+               iter_i    = iter_prev + writeTableBlock(retval, lines, s1);
                iter_prev = str.constEnd();
                iter_end  = iter_i + 1;
                continue;
@@ -3171,13 +3321,47 @@ static QString detab(QStringView str, int &refIndent)
    return retval;
 }
 
-QString processMarkdown(const QString &fileName, const int lineNr, QSharedPointer<Entry> e, const QString &input)
+// replaces the placeholders of a deferred page by the generated ids, starting at base
+static QString resolveAutoIds(const QString &text, int base)
 {
-   g_linkRefs.clear();
+   if (! text.contains(autoIdStart)) {
+      return text;
+   }
 
-   g_current  = e;
-   g_fileName = fileName;
-   g_lineNr   = lineNr;
+   QString retval;
+
+   QString::const_iterator iter     = text.constBegin();
+   QString::const_iterator iter_end = text.constEnd();
+
+   while (iter != iter_end) {
+
+      if (*iter == autoIdStart) {
+         int n = 0;
+         ++iter;
+
+         while (iter != iter_end && *iter != autoIdEnd) {
+            n = n * 10 + (iter->unicode() - '0');
+            ++iter;
+         }
+
+         if (iter != iter_end) {
+            ++iter;
+         }
+
+         retval += QString::number(base + n);
+
+      } else {
+         retval += *iter;
+         ++iter;
+      }
+   }
+
+   return retval;
+}
+
+static QString convertMarkdown(const QString &input)
+{
+   g_linkRefs.clear();
 
    if (input.isEmpty()) {
       return input;
@@ -3205,6 +3389,26 @@ QString processMarkdown(const QString &fileName, const int lineNr, QSharedPointe
    return out;
 }
 
+QString processMarkdown(const QString &fileName, const int lineNr, QSharedPointer<Entry> e, const QString &input)
+{
+   g_current  = e;
+   g_fileName = fileName;
+   g_lineNr   = lineNr;
+
+   if (! g_pendingFileName.isEmpty() && fileName == g_pendingFileName && input == g_pendingPage.docs) {
+      // page was converted ahead of time
+      g_pendingFileName.clear();
+
+      for (const auto &section : g_pendingPage.sections) {
+         addSection(section.id, section.header, section.type, section.level);
+      }
+
+      return std::move(g_pendingPage.output);
+   }
+
+   return convertMarkdown(input);
+}
+
 QString markdownFileNameToId(const QString &fileName)
 {
    QString baseFn = stripFromPath(QFileInfo(fileName).absoluteFilePath());
@@ -3219,20 +3423,10 @@ QString markdownFileNameToId(const QString &fileName)
    return "md_" + baseName;
 }
 
-void MarkdownFileParser::parseInput(const QString &fileName, const QString &fileBuf, QSharedPointer<Entry> root,
-                  enum ParserMode mode, QStringList &includedFiles, bool useClang)
+// returns the text of a standalone page, adds a page command if the file does not start with one
+static QString pageDocs(const QString &fileName, const QString &fileBuf)
 {
-   (void) mode;
-   (void) includedFiles;
-   (void) useClang;
-
    static const QString mdfileAsMainPage = Config::getString("mdfile-mainpage");
-   QSharedPointer<Entry> current = QMakeShared<Entry>();
-
-   current->setData(EntryKey::File_Name, fileName);
-   current->setData(EntryKey::MainDocs_File, fileName);
-   current->docLine  = 1;
-   current->m_srcLang = SrcLangExt_Markdown;
 
    QString id;
    QString docs    = fileBuf;
@@ -3273,6 +3467,110 @@ void MarkdownFileParser::parseInput(const QString &fileName, const QString &file
       }
    }
 
+   return docs;
+}
+
+static void convertPage(const QString &fileName, const QString &input, MarkdownPage &page)
+{
+   g_deferred = &page;
+
+   page.docs   = pageDocs(fileName, input);
+   page.output = convertMarkdown(page.docs);
+
+   g_deferred = nullptr;
+}
+
+void MarkdownFileParser::prefetchPages(const QVector<QPair<QString, QString>> &pages)
+{
+   static const int maxTasks = qMax(2, QThread::idealThreadCount());
+
+   QStringList fileNames;
+   QVector<const QString *> inputs;
+   QVector<MarkdownPage> converted;
+
+   for (const auto &item : pages) {
+
+      if (item.second.contains(autoIdStart)) {
+         // placeholder would be ambiguous, convert this page when it is parsed
+         continue;
+      }
+
+      fileNames.append(item.first);
+      inputs.append(&item.second);
+      converted.append(MarkdownPage());
+   }
+
+   std::atomic<int> next(0);
+
+   auto worker = [&fileNames, &inputs, &converted, &next] () {
+      int index;
+
+      while ((index = next++) < fileNames.size()) {
+         convertPage(fileNames[index], *inputs[index], converted[index]);
+      }
+   };
+
+   std::vector<std::future<void>> tasks;
+
+   for (int i = 1; i < qMin(maxTasks, static_cast<int>(fileNames.size())); ++i) {
+      tasks.push_back(std::async(std::launch::async, worker));
+   }
+
+   worker();
+
+   for (auto &task : tasks) {
+      task.get();
+   }
+
+   for (int i = 0; i < fileNames.size(); ++i) {
+      g_prefetchedPages.insert(fileNames[i], std::move(converted[i]));
+   }
+}
+
+bool MarkdownFileParser::hasPrefetchedPage(const QString &fileName)
+{
+   return g_prefetchedPages.contains(fileName);
+}
+
+void MarkdownFileParser::parseInput(const QString &fileName, const QString &fileBuf, QSharedPointer<Entry> root,
+                  enum ParserMode mode, QStringList &includedFiles, bool useClang)
+{
+   (void) mode;
+   (void) includedFiles;
+   (void) useClang;
+
+   QSharedPointer<Entry> current = QMakeShared<Entry>();
+
+   current->setData(EntryKey::File_Name, fileName);
+   current->setData(EntryKey::MainDocs_File, fileName);
+   current->docLine  = 1;
+   current->m_srcLang = SrcLangExt_Markdown;
+
+   QString docs;
+   auto iter = g_prefetchedPages.find(fileName);
+
+   if (iter != g_prefetchedPages.end()) {
+      // number the generated ids now so they match the order of a serial run
+      g_pendingPage = std::move(iter.value());
+      g_prefetchedPages.erase(iter);
+
+      const int base = g_autoId;
+      g_autoId += g_pendingPage.autoIdCount;
+
+      g_pendingPage.docs   = resolveAutoIds(g_pendingPage.docs, base);
+      g_pendingPage.output = resolveAutoIds(g_pendingPage.output, base);
+
+      for (auto &section : g_pendingPage.sections) {
+         section.id = resolveAutoIds(section.id, base);
+      }
+
+      g_pendingFileName = fileName;
+      docs = g_pendingPage.docs;
+
+   } else {
+      docs = pageDocs(fileName, fileBuf);
+   }
+
    int lineNr   = 1;
    int position = 0;
 
@@ -3302,6 +3600,9 @@ void MarkdownFileParser::parseInput(const QString &fileName, const QString &file
       root->addSubEntry(current, root);
    }
 
+   g_pendingFileName.clear();
+   g_pendingPage = MarkdownPage();
+
    // restore setting
    Doxy_Globals::markdownSupport = markdownEnabled;
 }
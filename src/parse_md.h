@@ -19,6 +19,9 @@
 #ifndef PARSE_MD_H
 #define PARSE_MD_H
 
+#include <QPair>
+#include <QVector>
+
 #include <parse_base.h>
 
 class Entry;
@@ -41,6 +44,11 @@ class MarkdownFileParser : public ParserInterface
       return false;
    }
 
+   // converts standalone pages concurrently, pairs are the file name and the buffer parseInput() would be passed,
+   // parseInput() uses the converted page and ignores its buffer
+   static void prefetchPages(const QVector<QPair<QString, QString>> &pages);
+   static bool hasPrefetchedPage(const QString &fileName);
+
    void parseCode(CodeOutputInterface &codeOutIntf, const QString &scopeName, const QString &input, SrcLangExt lang,
                   bool isExampleBlock, const QString &exampleName = QString(),
                   QSharedPointer<FileDef> fileDef = QSharedPointer<FileDef>(),
@@ -1723,7 +1723,7 @@ static void addPerlModDocBlock(PerlModOutput &output, const QString &name, const
 
    } else {
 
-      DocNode *root = validatingParseDoc(fileName, lineNr, scope, md, stext, false, false);
+      QSharedPointer<DocRoot> root = sharedParseDoc(fileName, lineNr, scope, md, stext, false, false);
       output.openHash(name);
 
       PerlModDocVisitor *visitor = new PerlModDocVisitor(output);
@@ -1732,7 +1732,6 @@ static void addPerlModDocBlock(PerlModOutput &output, const QString &name, const
       output.closeHash();
 
       delete visitor;
-      delete root;
    }
 }
 
@@ -22,7 +22,7 @@
 void initPreprocessor();
 void removePreProcessor();
 void addSearchDir(const QString &dir);
-QString preprocessFile(const QString &fileName, const QString &input);
+QString preprocessFile(const QString &fileName, QString input);
 void preFreeScanner();
 
 #endif
@@ -22,6 +22,8 @@
 #include <QList>
 #include <QSharedPointer>
 
+#include <algorithm>
+
 #include <sortedlist_fwd.h>
 
 class BaseClassDef;
@@ -44,6 +46,11 @@ class SortedList : public QList<T>
       bool contains(const U &data);
 
       void inSort(const T &data);
+
+      // bulk insert, append each item and call sortAppended() once when done
+      void appendUnsorted(const T &data);
+      void sortAppended();
+
       void sort();
 };
 
@@ -70,10 +77,32 @@ void SortedList<T, flag>::inSort(const T &data)
    this->insert(location, data);  
 }
 
+template <class T, bool flag>
+void SortedList<T, flag>::appendUnsorted(const T &data)
+{
+   this->append(data);
+}
+
+template <class T, bool flag>
+void SortedList<T, flag>::sortAppended()
+{
+   auto lessThan = [](const T &temp1, const T &temp2) { return compareListValues(temp1, temp2, flag) < 0; };
+
+   std::stable_sort(this->begin(), this->end(), lessThan);
+
+   // inSort() places an item in front of the items which compare equal, keep that order
+   for (auto iter = this->begin(); iter != this->end(); ) {
+      auto iter_next = std::upper_bound(iter, this->end(), *iter, lessThan);
+
+      std::reverse(iter, iter_next);
+      iter = iter_next;
+   }
+}
+
 template <class T, bool flag>
 void SortedList<T, flag>::sort()
 {
-   std::sort(this->begin(), this->end(), 
+   std::sort(this->begin(), this->end(),
                   [](const T &temp1, const T &temp2) { return  compareListValues(temp1, temp2, flag) < 0; } );
 }
 
@@ -68,20 +68,63 @@ template<class T, class SC = StringCompare>
 class StringMap
 {
 
+ public:
+   using iterator       = typename QMap<QString, T, SC>::iterator;
+   using const_iterator = typename QMap<QString, T, SC>::const_iterator;
+
  private:
    QMap<QString, T, SC> m_dict;
 
+   // optional hash index used by find(), iteration always uses the sorted map
+   QHash<QString, iterator> m_index;
+   bool m_hashIndex;
+   Qt::CaseSensitivity m_hashCase;
+
+   QString hashKey(const QString &key) const {
+      if (m_hashCase == Qt::CaseSensitive) {
+         return key;
+      }
+
+      return key.toLower();
+   }
+
+   void rebuildIndex() {
+      m_index.clear();
+
+      if (m_hashIndex) {
+         for (auto iter = m_dict.begin(); iter != m_dict.end(); ++iter) {
+            m_index.insert(hashKey(iter.key()), iter);
+         }
+      }
+   }
+
  public:
    // create an ordered dictionary
    // indicate whether the keys should be sorted in a case sensitive way
 
-   using iterator       = typename QMap<QString, T, SC>::iterator;
-   using const_iterator = typename QMap<QString, T, SC>::const_iterator;
+   StringMap(SC compare) : m_dict(compare), m_hashIndex(false), m_hashCase(Qt::CaseSensitive) {
+   }
+
+   // hashIndex, large dictionaries which are searched often can keep a hash index for find()
+   StringMap(Qt::CaseSensitivity sortCase_enum = Qt::CaseSensitive, bool hashIndex = false)
+      : m_dict(StringCompare(sortCase_enum)), m_hashIndex(hashIndex), m_hashCase(sortCase_enum) {
+   }
 
-   StringMap(SC compare) : m_dict(compare) {
+   StringMap(const StringMap &other)
+      : m_dict(other.m_dict), m_hashIndex(other.m_hashIndex), m_hashCase(other.m_hashCase) {
+      rebuildIndex();
    }
 
-   StringMap(Qt::CaseSensitivity sortCase_enum = Qt::CaseSensitive) : m_dict(StringCompare(sortCase_enum)) {
+   StringMap &operator=(const StringMap &other) {
+      if (this != &other) {
+         m_dict      = other.m_dict;
+         m_hashIndex = other.m_hashIndex;
+         m_hashCase  = other.m_hashCase;
+
+         rebuildIndex();
+      }
+
+      return *this;
    }
 
    virtual ~StringMap() {
@@ -97,6 +140,7 @@ class StringMap
 
    void clear() {
       m_dict.clear();
+      m_index.clear();
    }
 
    int count() const {
@@ -121,7 +165,18 @@ class StringMap
    }
 
    T find(const QString &key) const {
-       auto item = m_dict.find(key);
+
+      if (m_hashIndex) {
+         auto item = m_index.constFind(hashKey(key));
+
+         if (item == m_index.constEnd()) {
+            return T();
+         }
+
+         return item.value().value();
+      }
+
+      auto item = m_dict.find(key);
 
       if (item == m_dict.end()) {
          return T();
@@ -131,7 +186,11 @@ class StringMap
    }
 
    void insert(QString key, const T &d) {
-      m_dict.insert(key, d);
+      auto item = m_dict.insert(key, d);
+
+      if (m_hashIndex) {
+         m_index.insert(hashKey(key), item);
+      }
    }
 
    bool isEmpty() const {
@@ -140,15 +199,34 @@ class StringMap
 
    // Remove an item from the dictionary
    bool remove(const QString &key) {
+      if (m_hashIndex) {
+         m_index.remove(hashKey(key));
+      }
+
       return m_dict.remove(key);
    }
 
    // Take an item out of the dictionary without deleting it
    T *take(const QString &key) {
+      if (m_hashIndex) {
+         m_index.remove(hashKey(key));
+      }
+
       return m_dict.take(key);
    }
 
    T &operator[](const QString &key) {
+      if (m_hashIndex) {
+         auto item = m_dict.find(key);
+
+         if (item == m_dict.end()) {
+            item = m_dict.insert(key, T());
+            m_index.insert(hashKey(key), item);
+         }
+
+         return item.value();
+      }
+
       return m_dict[key];
    }
 
@@ -356,8 +434,8 @@ class LongMap
 class ClassSDict : public StringMap<QSharedPointer<ClassDef>>
 {
  public:
-   ClassSDict(Qt::CaseSensitivity isCase = Qt::CaseSensitive)
-      : StringMap<QSharedPointer<ClassDef>>(isCase)
+   ClassSDict(Qt::CaseSensitivity isCase = Qt::CaseSensitive, bool hashIndex = false)
+      : StringMap<QSharedPointer<ClassDef>>(isCase, hashIndex)
    {}
 
    ~ClassSDict() {}
@@ -469,7 +547,7 @@ class MemberSDict : public StringMap<QSharedPointer<MemberDef>>
 class MemberNameSDict : public StringMap<QSharedPointer<MemberName>>
 {
    public:
-      MemberNameSDict() : StringMap<QSharedPointer<MemberName>>() {}
+      MemberNameSDict(bool hashIndex = false) : StringMap<QSharedPointer<MemberName>>(Qt::CaseSensitive, hashIndex) {}
       ~MemberNameSDict() {}
 
    private:
@@ -493,7 +571,7 @@ class NamespaceSDict : public StringMap<QSharedPointer<NamespaceDef>>
 {
    public:
       // CopperSpice - can add isCase
-      NamespaceSDict() : StringMap<QSharedPointer<NamespaceDef>>() {}
+      NamespaceSDict(bool hashIndex = false) : StringMap<QSharedPointer<NamespaceDef>>(Qt::CaseSensitive, hashIndex) {}
       ~NamespaceSDict() {}
 
       void writeDeclaration(OutputList &ol, const QString &title, bool isConstantGroup = false, bool localName = false);
@@ -0,0 +1,76 @@
+/************************************************************************
+*
+* Copyright (C) 2014-2020 Barbara Geller & Ansel Sermersheim
+* Copyright (C) 1997-2014 by Dimitri van Heesch
+*
+* DoxyPress is free software: you can redistribute it and/or
+* modify it under the terms of the GNU General Public License version 2
+* as published by the Free Software Foundation.
+*
+* DoxyPress is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+*
+* Documents produced by DoxyPress are derivative works derived from the
+* input used in their production; they are not affected by this license.
+*
+*************************************************************************/
+
+#include <QHash>
+
+#include <unordered_set>
+
+#include <stringpool.h>
+
+#include <message.h>
+
+namespace {
+
+struct PoolHash {
+   size_t operator()(const QString &str) const {
+      return qHash(str);
+   }
+};
+
+// elements of an unordered_set are never moved, the address of a pooled string is stable
+using PoolSet = std::unordered_set<QString, PoolHash>;
+
+PoolSet &pool()
+{
+   static PoolSet retval;
+   return retval;
+}
+
+}
+
+const QString &StringPool::intern(const QString &str)
+{
+   if (str.isEmpty()) {
+      return emptyString();
+   }
+
+   return *pool().insert(str).first;
+}
+
+const QString &StringPool::emptyString()
+{
+   static const QString retval;
+   return retval;
+}
+
+int StringPool::count()
+{
+   return pool().size();
+}
+
+void StringPool::printStats()
+{
+   long long bytes = 0;
+
+   for (const auto &item : pool()) {
+      // storage is UTF-8
+      bytes += item.size_storage();
+   }
+
+   msg("String pool: %d strings, %lld bytes\n", count(), bytes);
+}
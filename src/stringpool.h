@@ -0,0 +1,90 @@
+/************************************************************************
+*
+* Copyright (C) 2014-2020 Barbara Geller & Ansel Sermersheim
+* Copyright (C) 1997-2014 by Dimitri van Heesch
+*
+* DoxyPress is free software: you can redistribute it and/or
+* modify it under the terms of the GNU General Public License version 2
+* as published by the Free Software Foundation.
+*
+* DoxyPress is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+*
+* Documents produced by DoxyPress are derivative works derived from the
+* input used in their production; they are not affected by this license.
+*
+*************************************************************************/
+
+#ifndef STRINGPOOL_H
+#define STRINGPOOL_H
+
+#include <QString>
+
+/** @brief Global pool of immutable strings.
+ *
+ *  Names, qualified names and paths of definitions repeat many times. Each distinct
+ *  string is stored once and lives until the program exits. Two pooled strings are
+ *  equal when their addresses are equal.
+ */
+class StringPool
+{
+ public:
+   /*! Returns the pooled copy of \a str, adding it to the pool if required */
+   static const QString &intern(const QString &str);
+
+   /*! Returns the pooled empty string */
+   static const QString &emptyString();
+
+   /*! Number of distinct strings in the pool */
+   static int count();
+
+   /*! Print the number of strings and bytes used by the pool */
+   static void printStats();
+};
+
+/** @brief Handle to a string stored in the StringPool
+ *
+ *  Copying a PoolString copies a pointer, comparing two PoolStrings compares pointers.
+ */
+class PoolString
+{
+ public:
+   PoolString()
+      : m_str(&StringPool::emptyString())
+   { }
+
+   PoolString(const QString &str)
+      : m_str(&StringPool::intern(str))
+   { }
+
+   PoolString &operator=(const QString &str) {
+      m_str = &StringPool::intern(str);
+      return *this;
+   }
+
+   operator const QString &() const {
+      return *m_str;
+   }
+
+   const QString &str() const {
+      return *m_str;
+   }
+
+   bool isEmpty() const {
+      return m_str->isEmpty();
+   }
+
+   bool operator==(const PoolString &other) const {
+      return m_str == other.m_str;
+   }
+
+   bool operator!=(const PoolString &other) const {
+      return m_str != other.m_str;
+   }
+
+ private:
+   const QString *m_str;
+};
+
+#endif
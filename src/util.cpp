@@ -23,15 +23,22 @@
 #include <QHash>
 #include <QProcess>
 #include <QRegularExpression>
+#include <QSet>
 #include <QStringView>
 #include <QTextCodec>
+#include <QThread>
 
 #include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
 #include <errno.h>
 #include <math.h>
 
+#include <deque>
+
 #include <util.h>
 
+#include <asciiscan.h>
 #include <config.h>
 #include <default_args.h>
 #include <doxy_globals.h>
@@ -66,8 +73,8 @@ static QCache<QPair<const FileNameDict *, QString>, FindFileCacheElem> s_findFil
 static QSharedPointer<ClassDef> getResolvedClassRec(QSharedPointer<const Definition> scope, QSharedPointer<const FileDef> fileScope,
                   const QString &n, QSharedPointer<MemberDef> *pTypeDef, QString *pTemplSpec, QString *pResolvedType);
 
-static int isAccessibleFromWithExpScope(QSharedPointer<const Definition> scope, QSharedPointer<const FileDef> fileScope,
-                  QSharedPointer<const Definition> item, const QString &explicitScopePart);
+static int isAccessibleFromWithExpScope(const QSharedPointer<const Definition> &scope, const QSharedPointer<const FileDef> &fileScope,
+                  const QSharedPointer<const Definition> &item, const QString &explicitScopePart);
 
 #define HEXTONUM(x) (((x)>='0' && (x)<='9') ? ((x)-'0') :       \
                      ((x)>='a' && (x)<='f') ? ((x)-'a'+10) :    \
@@ -724,21 +731,20 @@ static QString substTypedef(QSharedPointer<const Definition> scopeDef, QSharedPo
    while (iter != Doxy_Globals::glossary().end() && iter.key() == phraseName)  {
       // search for the best match, only look at members
 
-      if (iter.value()->definitionType() == Definition::TypeMember) {
+      if (iter.value()->definitionType() == Definition::TypeMember &&
+            static_cast<const MemberDef *>(iter.value())->isTypedef()) {
          // which are also typedefs
          QSharedPointer<Definition> sharedPtr = sharedFrom(iter.value());
-         QSharedPointer<MemberDef> md = sharedPtr.dynamicCast<MemberDef>();
+         QSharedPointer<MemberDef> md = sharedPtr.staticCast<MemberDef>();
 
-         if (md->isTypedef()) {
-            // md is a typedef, test accessibility of typedef within scope
-            int distance = isAccessibleFromWithExpScope(scopeDef, fileScope, sharedPtr, "");
+         // md is a typedef, test accessibility of typedef within scope
+         int distance = isAccessibleFromWithExpScope(scopeDef, fileScope, sharedPtr, "");
 
-            if (distance != -1 && distance < minDistance) {
-               // definition is accessible and a better match
+         if (distance != -1 && distance < minDistance) {
+            // definition is accessible and a better match
 
-               minDistance = distance;
-               bestMatch = md;
-            }
+            minDistance = distance;
+            bestMatch = md;
          }
       }
 
@@ -839,14 +845,14 @@ static QSharedPointer< const Definition> followPath(QSharedPointer<const Definit
    return current;
 }
 
-bool accessibleViaUsingClass(const StringMap<QSharedPointer<Definition>> *cl, QSharedPointer<const FileDef> fileScope,
-                             QSharedPointer<const Definition> item, const QString &explicitScopePart = QString(""))
+bool accessibleViaUsingClass(const StringMap<QSharedPointer<Definition>> *cl, const QSharedPointer<const FileDef> &fileScope,
+                             const QSharedPointer<const Definition> &item, const QString &explicitScopePart = QString(""))
 {
    if (cl) {
       // see if the class was imported via a using statement
       bool explicitScopePartEmpty = explicitScopePart.isEmpty();
 
-      for (auto ucd : *cl) {
+      for (const auto &ucd : *cl) {
 
          QSharedPointer<const Definition> sc;
 
@@ -867,15 +873,15 @@ bool accessibleViaUsingClass(const StringMap<QSharedPointer<Definition>> *cl, QS
    return false;
 }
 
-static bool accessibleViaUsingNamespace(const NamespaceSDict *nl, QSharedPointer<const FileDef> fileScope,
-                  QSharedPointer<const Definition> item, const QString &explicitScopePart = QString(""))
+static bool accessibleViaUsingNamespace(const NamespaceSDict *nl, const QSharedPointer<const FileDef> &fileScope,
+                  const QSharedPointer<const Definition> &item, const QString &explicitScopePart = QString(""))
 {
    static QSet<QString> visitedDict;
 
    if (nl) {
       // check used namespaces for the class
 
-      for (auto und : *nl) {
+      for (const auto &und : *nl) {
          QSharedPointer<const Definition> sc;
 
          if (explicitScopePart.isEmpty()) {
@@ -909,6 +915,8 @@ static bool accessibleViaUsingNamespace(const NamespaceSDict *nl, QSharedPointer
 }
 
 /** Helper class representing the stack of items considered while resolving the scope.
+ *  Only used to detect recursion, the definitions are owned by the global dictionaries
+ *  so the stack holds plain pointers and does not touch the reference counts.
  */
 class AccessStack
 {
@@ -916,8 +924,7 @@ class AccessStack
    AccessStack() : m_index(0)
    {}
 
-   void push(QSharedPointer<const Definition> scopeDef, QSharedPointer<const FileDef> fileScope,
-                  QSharedPointer<const Definition> item) {
+   void push(const Definition *scopeDef, const FileDef *fileScope, const Definition *item) {
 
       if (m_index < MAX_STACK_SIZE) {
          m_elements[m_index].scopeDef  = scopeDef;
@@ -927,8 +934,7 @@ class AccessStack
       }
    }
 
-   void push(QSharedPointer<const Definition> scopeDef, QSharedPointer<const FileDef> fileScope,
-                  QSharedPointer<const Definition> item, const QString &expScope) {
+   void push(const Definition *scopeDef, const FileDef *fileScope, const Definition *item, const QString &expScope) {
 
       if (m_index < MAX_STACK_SIZE) {
          m_elements[m_index].scopeDef  = scopeDef;
@@ -945,8 +951,7 @@ class AccessStack
       }
    }
 
-   bool find(QSharedPointer<const Definition> scopeDef, QSharedPointer<const FileDef> fileScope,
-                  QSharedPointer<const Definition> item) {
+   bool find(const Definition *scopeDef, const FileDef *fileScope, const Definition *item) {
 
       for (int i = 0; i < m_index; i++) {
          AccessElem *e = &m_elements[i];
@@ -959,8 +964,7 @@ class AccessStack
       return false;
    }
 
-   bool find(QSharedPointer<const Definition> scopeDef, QSharedPointer<const FileDef> fileScope,
-             QSharedPointer<const Definition> item, const QString &expScope) {
+   bool find(const Definition *scopeDef, const FileDef *fileScope, const Definition *item, const QString &expScope) {
 
       for (int i = 0; i < m_index; i++) {
          AccessElem *e = &m_elements[i];
@@ -976,9 +980,9 @@ class AccessStack
  private:
    /** Element in the stack */
    struct AccessElem {
-      QSharedPointer<const Definition>  scopeDef;
-      QSharedPointer<const FileDef>     fileScope;
-      QSharedPointer<const Definition>  item;
+      const Definition *scopeDef;
+      const FileDef    *fileScope;
+      const Definition *item;
 
       QString expScope;
    };
@@ -990,32 +994,32 @@ class AccessStack
 /* Returns the "distance" (=number of levels up) from item to scope, or -1
  * if item in not inside scope.
  */
-int isAccessibleFrom(QSharedPointer<const Definition> scopeDef, QSharedPointer<const FileDef> fileScope,
-                  QSharedPointer<const Definition> item)
+int isAccessibleFrom(const QSharedPointer<const Definition> &scopeDef, const QSharedPointer<const FileDef> &fileScope,
+                  const QSharedPointer<const Definition> &item)
 {
    static AccessStack accessStack;
 
-   if (accessStack.find(scopeDef, fileScope, item)) {
+   if (accessStack.find(scopeDef.data(), fileScope.data(), item.data())) {
       return -1;
    }
-   accessStack.push(scopeDef, fileScope, item);
+   accessStack.push(scopeDef.data(), fileScope.data(), item.data());
 
    // assume we found it
    int result = 0;
    int i;
 
-   QSharedPointer<Definition>       itemScope     = item->getOuterScope();
-   QSharedPointer<const ClassDef>   tempPtr       = scopeDef.dynamicCast<const ClassDef>();
-   QSharedPointer<const MemberDef>  tempItem      = item.dynamicCast<const MemberDef>();
-   QSharedPointer<const ClassDef>   tempItemScope = item.dynamicCast<const ClassDef>();
+   QSharedPointer<Definition> itemScope = item->getOuterScope();
 
+   // only cast when the types are known to match
    bool memberAccessibleFromScope = (item->definitionType() == Definition::TypeMember &&
        itemScope && itemScope->definitionType() == Definition::TypeClass  &&
-       scopeDef->definitionType() == Definition::TypeClass && tempPtr->isAccessibleMember(tempItem));
+       scopeDef->definitionType() == Definition::TypeClass &&
+       scopeDef.staticCast<const ClassDef>()->isAccessibleMember(item.staticCast<const MemberDef>()));
 
    bool nestedClassInsideBaseClass = (item->definitionType() == Definition::TypeClass &&
        itemScope && itemScope->definitionType() == Definition::TypeClass &&
-       scopeDef->definitionType() == Definition::TypeClass && tempPtr->isBaseClass(tempItemScope, true));
+       scopeDef->definitionType() == Definition::TypeClass &&
+       scopeDef.staticCast<const ClassDef>()->isBaseClass(item.staticCast<const ClassDef>(), true));
 
    if (itemScope == scopeDef || memberAccessibleFromScope || nestedClassInsideBaseClass) {
 
@@ -1050,15 +1054,15 @@ int isAccessibleFrom(QSharedPointer<const Definition> scopeDef, QSharedPointer<c
       // keep searching, check if scope is a namespace, which is using other classes and namespaces
 
       if (scopeDef->definitionType() == Definition::TypeNamespace) {
-         QSharedPointer<const NamespaceDef> nscope = scopeDef.dynamicCast<const NamespaceDef>();
+         QSharedPointer<const NamespaceDef> nscope = scopeDef.staticCast<const NamespaceDef>();
 
-         StringMap<QSharedPointer<Definition>> cl = nscope->getUsedClasses();
+         const StringMap<QSharedPointer<Definition>> &cl = nscope->getUsedClasses();
 
          if (accessibleViaUsingClass(&cl, fileScope, item)) {
             goto done;
          }
 
-         NamespaceSDict nl = nscope->getUsedNamespaces();
+         const NamespaceSDict &nl = nscope->getUsedNamespaces();
 
          if (accessibleViaUsingNamespace(&nl, fileScope, item)) {
             goto done;
@@ -1092,8 +1096,8 @@ done:
  *   not found and then A::I is searched in the global scope, which matches and
  *   thus the result is 1.
  */
-int isAccessibleFromWithExpScope(QSharedPointer<const Definition> scopeDef, QSharedPointer<const FileDef> fileScope,
-                  QSharedPointer<const Definition> item, const QString &explicitScopePart)
+int isAccessibleFromWithExpScope(const QSharedPointer<const Definition> &scopeDef, const QSharedPointer<const FileDef> &fileScope,
+                  const QSharedPointer<const Definition> &item, const QString &explicitScopePart)
 {
    if (explicitScopePart.isEmpty()) {
       // handle degenerate case where there is no explicit scope
@@ -1101,11 +1105,11 @@ int isAccessibleFromWithExpScope(QSharedPointer<const Definition> scopeDef, QSha
    }
 
    static AccessStack accessStack;
-   if (accessStack.find(scopeDef, fileScope, item, explicitScopePart)) {
+   if (accessStack.find(scopeDef.data(), fileScope.data(), item.data(), explicitScopePart)) {
       return -1;
    }
 
-   accessStack.push(scopeDef, fileScope, item, explicitScopePart);
+   accessStack.push(scopeDef.data(), fileScope.data(), item.data(), explicitScopePart);
 
    // assume we found it
    int result = 0;
@@ -1143,18 +1147,18 @@ int isAccessibleFromWithExpScope(QSharedPointer<const Definition> scopeDef, QSha
             // A::B::C but is explicit referenced as A::C, where B is imported
             // in A via a using directive.
 
-            QSharedPointer<const NamespaceDef> nscope = newScope.dynamicCast<const NamespaceDef>();
-            StringMap<QSharedPointer<Definition>> cl = nscope->getUsedClasses();
+            QSharedPointer<const NamespaceDef> nscope = newScope.staticCast<const NamespaceDef>();
+            const StringMap<QSharedPointer<Definition>> &cl = nscope->getUsedClasses();
 
-            for (auto cd : cl) {
+            for (const auto &cd : cl) {
                if (cd == item) {
                   goto done;
                }
             }
 
-            NamespaceSDict nl = nscope->getUsedNamespaces();
+            const NamespaceSDict &nl = nscope->getUsedNamespaces();
 
-            for (auto nd : nl) {
+            for (const auto &nd : nl) {
                if (! s_visitedNamespaces.contains(nd->name())) {
                   i = isAccessibleFromWithExpScope(scopeDef, fileScope, item, nd->name());
                   if (i != -1) {
@@ -1176,8 +1180,8 @@ int isAccessibleFromWithExpScope(QSharedPointer<const Definition> scopeDef, QSha
       // failed to resolve explicitScope
 
       if (scopeDef->definitionType() == Definition::TypeNamespace) {
-         QSharedPointer<const NamespaceDef> nscope = scopeDef.dynamicCast<const NamespaceDef>();
-         NamespaceSDict nl = nscope->getUsedNamespaces();
+         QSharedPointer<const NamespaceDef> nscope = scopeDef.staticCast<const NamespaceDef>();
+         const NamespaceSDict &nl = nscope->getUsedNamespaces();
 
          if (accessibleViaUsingNamespace(&nl, fileScope, item, explicitScopePart)) {
             // found in used namespace
@@ -1465,10 +1469,24 @@ static QSharedPointer<ClassDef> getResolvedClassRec(QSharedPointer<const Definit
    int minDistance = 10000;
 
    while (iter != Doxy_Globals::glossary().end() && iter.key() == name)  {
-      QSharedPointer<Definition> def = sharedFrom(iter.value());
+      // only classes and members which are enums or typedefs are considered, test this on the raw
+      // pointer so other symbols with the same name do not pay for a shared pointer
+
+      const Definition *rawDef = iter.value();
+      bool isCandidate = (rawDef->definitionType() == Definition::TypeClass);
+
+      if (rawDef->definitionType() == Definition::TypeMember) {
+         const MemberDef *rawMd = static_cast<const MemberDef *>(rawDef);
+         isCandidate = rawMd->isTypedef() || rawMd->isEnumerate();
+      }
+
+      if (isCandidate) {
+         QSharedPointer<Definition> def = sharedFrom(iter.value());
+
+         getResolvedSymbol(scope, fileScope, def, explicitScopePart, &actTemplParams,
+                           minDistance, bestMatch, bestTypedef, bestTemplSpec, bestResolvedType);
+      }
 
-      getResolvedSymbol(scope, fileScope, def, explicitScopePart, &actTemplParams,
-                        minDistance, bestMatch, bestTypedef, bestTemplSpec, bestResolvedType);
       ++iter;
    }
 
@@ -1980,7 +1998,16 @@ void linkifyText(const TextGeneratorIntf &out, QSharedPointer<const Definition>
 
       bool found = false;
 
+      // most words never resolve, remember the ones which did not resolve in this scope,
+      // names of scopes are not unique so the scope is identified by its address
+      QString unresolvedKey;
+
       if (! insideString) {
+         unresolvedKey = QString::number(reinterpret_cast<quintptr>(scope.data()), 16) + "+" +
+                  (fileScope ? fileScope->getFilePath() : QString()) + "+" + matchWord;
+      }
+
+      if (! insideString && Doxy_Globals::unresolvedLinkCache.object(unresolvedKey) == nullptr) {
          QSharedPointer<ClassDef>     cd;
          QSharedPointer<FileDef>      fd;
          QSharedPointer<MemberDef>    md;
@@ -1990,6 +2017,8 @@ void linkifyText(const TextGeneratorIntf &out, QSharedPointer<const Definition>
 
          cd = getResolvedClass(scope, fileScope, matchWord, &typeDef);
 
+         bool hasCandidate = (typeDef != nullptr);
+
          if (typeDef) {
             // first look at typedef then class
 
@@ -2003,10 +2032,11 @@ void linkifyText(const TextGeneratorIntf &out, QSharedPointer<const Definition>
          }
 
          if (! found && (cd || (cd = getClass(matchWord)))) {
+            hasCandidate = true;
 
             if (external ? cd->isLinkable() : cd->isLinkableInProject()) {
 
-               if (cd == def || (scope && cd->name() == scope->name()) ) {
+               if (cd == def || (scope && cd->hasSameName(*scope)) ) {
                   // do not link to the current scope (added 01/2016)
 
                } else {
@@ -2019,6 +2049,7 @@ void linkifyText(const TextGeneratorIntf &out, QSharedPointer<const Definition>
          } else if ((cd = getClass(matchWord + "-p"))) {
             // search for Obj-C protocols
             // add link to the result
+            hasCandidate = true;
 
             if (external ? cd->isLinkable() : cd->isLinkableInProject()) {
                if (cd != def) {
@@ -2041,6 +2072,7 @@ void linkifyText(const TextGeneratorIntf &out, QSharedPointer<const Definition>
          }
 
          if (! found && getDefs(scopeName, matchWord, "", md, cd, fd, nd, gd)) {
+            hasCandidate = true;
             bool ok;
 
             if (external) {
@@ -2050,7 +2082,7 @@ void linkifyText(const TextGeneratorIntf &out, QSharedPointer<const Definition>
             }
 
             if (ok) {
-               if (md != def && (def == nullptr || md->name() != def->name()) ) {
+               if (md != def && (def == nullptr || ! md->hasSameName(*def)) ) {
                   // name check is needed for overloaded members, where getDefs returns one
 
                   if (word.contains("(")) {
@@ -2073,6 +2105,10 @@ void linkifyText(const TextGeneratorIntf &out, QSharedPointer<const Definition>
                }
             }
          }
+
+         if (! hasCandidate) {
+            Doxy_Globals::unresolvedLinkCache.insert(unresolvedKey, new bool(true));
+         }
       }
 
       if (! found) {
@@ -2409,10 +2445,39 @@ QString getFileFilter(const QString &name, bool isSourceCode)
    }
 }
 
+// true if the configured input codec is a stateless superset of ASCII, ASCII input can then skip the codec
+// stateful 7-bit codecs (ISO-2022, UTF-7, HZ) are excluded since escape sequences in ASCII bytes change the text
+static bool isAsciiCompatibleEncoding()
+{
+   static const QString inputEncoding = Config::getString("input-encoding");
+   static bool retval = [] () {
+      QTextCodec *codec = QTextCodec::codecForName(inputEncoding.constData());
+
+      if (codec == nullptr) {
+         return false;
+      }
+
+      int mib = codec->mibEnum();
+
+      return mib == 3                         // US-ASCII
+            || (mib >= 4 && mib <= 13)        // ISO-8859-1 to ISO-8859-10
+            || (mib >= 109 && mib <= 112)     // ISO-8859-13 to ISO-8859-16
+            || mib == 106                     // UTF-8
+            || (mib >= 2250 && mib <= 2258)   // windows-1250 to windows-1258
+            || mib == 2084 || mib == 2088;    // KOI8-R, KOI8-U
+   } ();
+
+   return retval;
+}
+
 QString transcodeToQString(const QByteArray &input)
 {
    static const QString inputEncoding = Config::getString("input-encoding");
 
+   if (isAsciiCompatibleEncoding() && isAsciiBuffer(input.constData(), input.size())) {
+      return QString::fromUtf8(input);
+   }
+
    QTextCodec *tmp = QTextCodec::codecForName(inputEncoding.constData());
 
    if (! tmp) {
@@ -3243,7 +3308,7 @@ static QString getCanonicalTypeForIdentifier(QSharedPointer<Definition> d, QShar
    return result;
 }
 
-static QString extractCanonicalType(QSharedPointer<Definition> def, QSharedPointer<FileDef> fs, QString type)
+static QString extractCanonicalType_Internal(QSharedPointer<Definition> def, QSharedPointer<FileDef> fs, QString type)
 {
    type = type.trimmed();
 
@@ -3317,6 +3382,28 @@ static QString extractCanonicalType(QSharedPointer<Definition> def, QSharedPoint
    return removeRedundantWhiteSpace(canType);
 }
 
+static QString extractCanonicalType(QSharedPointer<Definition> def, QSharedPointer<FileDef> fs, QString type)
+{
+   // the same type strings are resolved over and over in the same scope while matching
+   // overloaded members, key is the scope, the file scope and the type
+
+   // names of scopes are not unique (files with the same name in different directories, a class and
+   // a namespace with the same name), the scope is identified by its address instead
+   QString key = QString::number(reinterpret_cast<quintptr>(def.data()), 16) + "+" +
+                  (fs ? fs->getFilePath() : QString()) + "+" + type;
+
+   QString *cached = Doxy_Globals::canonicalTypeCache.object(key);
+
+   if (cached != nullptr) {
+      return *cached;
+   }
+
+   QString retval = extractCanonicalType_Internal(def, fs, type);
+   Doxy_Globals::canonicalTypeCache.insert(key, new QString(retval));
+
+   return retval;
+}
+
 static QString extractCanonicalArgType(QSharedPointer<Definition> d, QSharedPointer<FileDef> fs, const Argument &arg)
 {
    QString type = arg.type.trimmed();
@@ -3350,40 +3437,22 @@ static bool matchArgument_Internal(QSharedPointer<Definition> srcScope, QSharedP
             QSharedPointer<Definition> dstScope, QSharedPointer<FileDef> dstFileScope,
             const Argument &dstArg)
 {
-   QString srcName = " " + srcArg.name;
-   QString dstName = " " + dstArg.name;
-   QString srcType = srcArg.type;
-   QString dstType = dstArg.type;
-
-   stripIrrelevantConstVolatile(srcType);
-   stripIrrelevantConstVolatile(dstType);
-
    if (srcArg.canType.isEmpty()) {
-      srcArg.canType = extractCanonicalArgType(srcScope, srcFileScope, srcArg);
+      srcArg.canType    = extractCanonicalArgType(srcScope, srcFileScope, srcArg);
+      srcArg.canTypeKey = QString(srcArg.canType).replace(" ", "");
    }
 
    if (dstArg.canType.isEmpty()) {
-      dstArg.canType = extractCanonicalArgType(dstScope, dstFileScope, dstArg);
+      dstArg.canType    = extractCanonicalArgType(dstScope, dstFileScope, dstArg);
+      dstArg.canTypeKey = QString(dstArg.canType).replace(" ", "");
    }
 
    if (srcArg.canType == dstArg.canType) {
       return true;
-
-   } else {
-      // remove spaces and test again
-      QString srcCanType = srcArg.canType;
-      QString dstCanType = dstArg.canType;
-
-      srcCanType.replace(" ", "");
-      dstCanType.replace(" ", "");
-
-      if (srcCanType == dstCanType) {
-         return true;
-
-      } else {
-         return false;
-      }
    }
+
+   // compare again with the spaces removed, computed once per argument
+   return srcArg.canTypeKey == dstArg.canTypeKey;
 }
 
 // algorithm for argument matching
@@ -3586,6 +3655,56 @@ static void findMembersWithSpecificName(QSharedPointer<MemberName> mn, const QSt
    }
 }
 
+// key used for the member signature index, the argument types with all spaces removed
+// the const and volatile specifiers are not part of the key
+static QString memberSignatureKey(const QString &qualifiedScope, const QString &name, const ArgumentList &argList)
+{
+   QString retval = qualifiedScope + "::" + name + "(";
+   bool first     = true;
+
+   for (const auto &arg : argList) {
+      if (! first) {
+         retval += ",";
+      }
+
+      retval += arg.type + arg.array;
+      first = false;
+   }
+
+   retval += ")";
+   retval.replace(" ", "");
+
+   return retval;
+}
+
+/*!
+ * Builds an index of all class members keyed by the fully qualified member name and the
+ * signature of the argument list. Used by getDefs() to resolve the exact match case
+ * without scanning every member with the same name.
+ */
+void buildMemberSignatureIndex()
+{
+   Doxy_Globals::memberSignatureIndex.clear();
+
+   for (auto mn : Doxy_Globals::memberNameSDict) {
+
+      for (auto md : *mn) {
+         QSharedPointer<ClassDef> cd = md->getClassDef();
+
+         if (cd == nullptr || md->isStrongEnumValue() || md->isDefine()) {
+            continue;
+         }
+
+         QString key = memberSignatureKey(cd->name(), md->name(), md->getArgumentList());
+
+         // the first member in the member name list wins, same as the linear search
+         if (! Doxy_Globals::memberSignatureIndex.contains(key)) {
+            Doxy_Globals::memberSignatureIndex.insert(key, md);
+         }
+      }
+   }
+}
+
 /*!
  * Searches for a member definition given its name `memberName' as a string.
  * memberName may also include a (partial) scope to indicate the scope
@@ -3692,6 +3811,24 @@ bool getDefs(const QString &scName, const QString &mbName, const QString &args,
 
             if (! args.isEmpty()) {
                argList = stringToArgumentList(args);
+
+               // exact match of a member in this class, no better match is possible
+               QSharedPointer<MemberDef> imd = Doxy_Globals::memberSignatureIndex.value(
+                     memberSignatureKey(fcd->name(), mName, argList));
+
+               if (imd && imd->getClassDef() == fcd && imd->isLinkable() &&
+                     imd->getArgumentList().refSpecifier == argList.refSpecifier && (! checkCV || (imd->getArgumentList().constSpecifier == argList.constSpecifier &&
+                     imd->getArgumentList().volatileSpecifier == argList.volatileSpecifier))) {
+
+                  md = imd;
+                  gd = md->getGroupDef();
+
+                  if (! gd) {
+                     cd = fcd;
+                  }
+
+                  return true;
+               }
             }
 
             for (auto mmd : *mn) {
@@ -4026,7 +4163,7 @@ bool getDefs(const QString &scName, const QString &mbName, const QString &args,
             if (currentFile) {
 
                for (auto md : members) {
-                  if (md->getFileDef() && md->getFileDef()->name() == currentFile->name()) {
+                  if (md->getFileDef() && md->getFileDef()->hasSameName(*currentFile)) {
                      break; // found match in the current file
                   }
                }
@@ -7009,13 +7146,12 @@ QString parseCommentAsText(QSharedPointer<const Definition> scope, QSharedPointe
       QSharedPointer<MemberDef> md_unconst = md.constCast<MemberDef>();
 
       QTextStream t_stream(&s);
-      DocNode *root = validatingParseDoc(fileName, lineNr, scope_unconst, md_unconst, doc, false, false);
+      QSharedPointer<DocRoot> root = sharedParseDoc(fileName, lineNr, scope_unconst, md_unconst, doc, false, false);
 
       TextDocVisitor *visitor = new TextDocVisitor(t_stream);
       root->accept(visitor);
 
       delete visitor;
-      delete root;
    }
 
    QString result = convertCharEntities(s);
@@ -7398,6 +7534,114 @@ QString readInputFile(const QString &fileName)
    return retval;
 }
 
+// UTF-8 input can be converted without going through a QTextCodec
+static bool isUtf8Encoding()
+{
+   static const QString inputEncoding = Config::getString("input-encoding");
+   static const bool retval = (inputEncoding.compare("UTF-8", Qt::CaseInsensitive) == 0 ||
+         inputEncoding.compare("UTF8", Qt::CaseInsensitive) == 0);
+
+   return retval;
+}
+
+// convert the raw contents of an input file, data may point into a memory mapped file
+static QString decodeInputBuffer(const char *data, int size)
+{
+   QString retval;
+
+   uchar tmp0 = 0;
+   uchar tmp1 = 0;
+   uchar tmp2 = 0;
+
+   if (size >= 2) {
+      tmp0 = data[0];
+      tmp1 = data[1];
+   }
+
+   if (size >= 3) {
+      tmp2 = data[2];
+   }
+
+   bool isUtf8 = false;
+
+   if ((tmp0 == 0xFF && tmp1 == 0xFE) || (tmp0 == 0xFE && tmp1 == 0xFF)) {
+      // UCS-2 encoded file
+      retval = QTextCodec::codecForMib(1015)->toUnicode(QByteArray(data, size));
+
+   } else if (tmp0 == 0xEF && tmp1 == 0xBB && tmp2 == 0xBF) {
+      // UTF-8 encoded file, remove UTF-8 BOM, no translation needed
+      data += 3;
+      size -= 3;
+
+      retval = QString::fromUtf8(data, size);
+      isUtf8 = true;
+
+   } else if (isUtf8Encoding()) {
+      // convert directly from the input data
+      retval = QString::fromUtf8(data, size);
+      isUtf8 = true;
+
+   } else if (isAsciiCompatibleEncoding() && isAsciiBuffer(data, size)) {
+      // plain ASCII is the same in every ASCII compatible encoding
+      retval = QString::fromUtf8(data, size);
+      isUtf8 = true;
+
+   } else {
+      // transcode according to the INPUT_ENCODING setting
+      // do character transcoding if needed
+
+      retval = transcodeToQString(QByteArray(data, size));
+   }
+
+   if (isUtf8 && memchr(data, '\r', size) == nullptr && memchr(data, '\0', size) == nullptr) {
+      // nothing for filterCRLF to do
+      return retval;
+   }
+
+   // translate CR's
+   return filterCRLF(retval);
+}
+
+// filtered input keyed by filter command and a hash of the unfiltered file, cost is the size in bytes
+static QCache<QString, QByteArray> &filterCache()
+{
+   static QCache<QString, QByteArray> retval(256 * 1024 * 1024);
+   return retval;
+}
+
+static QString filterCacheKey(const QString &cmd, const QString &fileName)
+{
+   QFile f(fileName);
+
+   if (! f.open(QIODevice::ReadOnly)) {
+      return QString();
+   }
+
+   QCryptographicHash hash(QCryptographicHash::Sha1);
+   hash.addData(&f);
+
+   return cmd + '\n' + QString::fromLatin1(hash.result().toHex());
+}
+
+static bool finishInputFilter(QProcess &filterProcess, const QString &cmd, QByteArray &buffer)
+{
+   filterProcess.waitForFinished(-1);
+
+   if (filterProcess.exitStatus() != QProcess::NormalExit) {
+      err("Unable to execute command:  %s\n", csPrintable(cmd) );
+      return false;
+   }
+
+   buffer = filterProcess.readAllStandardOutput();
+
+   QByteArray errorMsg = filterProcess.readAllStandardError();
+    if (! errorMsg.isEmpty()) {
+      err("Possible filter problem: %s\n", errorMsg.constData());
+   }
+
+   return true;
+}
+
 // read a file name
 bool readInputFile(const QString &fileName, QString &fileContents, bool filter, bool isSourceCode)
 {
@@ -7406,11 +7650,7 @@ bool readInputFile(const QString &fileName, QString &fileContents, bool filter,
       return false;
    }
 
-   // holds the data for fileContents
-   QByteArray buffer;
-
    QString filterName = getFileFilter(fileName, isSourceCode);
-   int size = 0;
 
    if (filterName.isEmpty() || ! filter) {
       // do not filter
@@ -7422,7 +7662,25 @@ bool readInputFile(const QString &fileName, QString &fileContents, bool filter,
          return false;
       }
 
-      size = fi.size();
+      int size = fi.size();
+
+      if (size == 0) {
+         fileContents = QString();
+         return true;
+      }
+
+      // map the file to avoid copying it into a buffer before it is decoded
+      uchar *mapped = f.map(0, size);
+
+      if (mapped != nullptr) {
+         fileContents = decodeInputBuffer(reinterpret_cast<const char *>(mapped), size);
+         f.unmap(mapped);
+
+         return true;
+      }
+
+      // holds the data for fileContents
+      QByteArray buffer;
       buffer.resize(size);
 
       if (f.read(buffer.data(), size) != size) {
@@ -7430,61 +7688,96 @@ bool readInputFile(const QString &fileName, QString &fileContents, bool filter,
          return false;
       }
 
+      fileContents = decodeInputBuffer(buffer.constData(), size);
+
    } else {
       // filter the file
       QString cmd = filterName + " \"" + fileName + "\"";
+      QString key = filterCacheKey(cmd, fileName);
+
+      // an empty key means the file could not be hashed, do not share its entry with other files
+      QByteArray *cached = key.isEmpty() ? nullptr : filterCache().object(key);
+
+      if (cached != nullptr) {
+         fileContents = decodeInputBuffer(cached->constData(), cached->size());
+         return true;
+      }
 
       QProcess filterProcess;
       filterProcess.start(cmd);
-      filterProcess.waitForFinished(-1);
 
-      if (filterProcess.exitStatus() != QProcess::NormalExit) {
-         err("Unable to execute command:  %s\n", csPrintable(cmd) );
+      QByteArray buffer;
+
+      if (! finishInputFilter(filterProcess, cmd, buffer)) {
          return false;
       }
 
-      buffer = filterProcess.readAllStandardOutput();
+      fileContents = decodeInputBuffer(buffer.constData(), buffer.size());
 
-      QByteArray errorMsg = filterProcess.readAllStandardError();
-       if (! errorMsg.isEmpty()) {
-         err("Possible filter problem: %s\n", errorMsg.constData());
+      if (! key.isEmpty()) {
+         filterCache().insert(key, new QByteArray(buffer), buffer.size());
       }
    }
 
-   uchar tmp0 = 0;
-   uchar tmp1 = 0;
-   uchar tmp2 = 0;
+   return true;
+}
 
-   if (size >= 2) {
-      tmp0 = buffer.at(0);
-      tmp1 = buffer.at(1);
-   }
+void prefetchInputFilters(const QStringList &fileNames, bool isSourceCode)
+{
+   static const int maxTasks = qMax(2, QThread::idealThreadCount());
 
-   if (size >= 3) {
-      tmp2 = buffer.at(2);
-   }
+   struct FilterTask {
+      QString cmd;
+      QString key;
+      QProcess *process;
+   };
 
-   if ((tmp0 == 0xFF && tmp1 == 0xFE) || (tmp0 == 0xFE && tmp1 == 0xFF)) {
-      // UCS-2 encoded file
-      fileContents = QTextCodec::codecForMib(1015)->toUnicode(buffer);
+   // filters which are running, oldest first
+   std::deque<FilterTask> running;
+   QSet<QString> started;
 
-   } else if (tmp0 == 0xEF && tmp1 == 0xBB && tmp2 == 0xBF) {
-      // UTF-8 encoded file, remove UTF-8 BOM, no translation needed
+   auto finishOldest = [&running] () {
+      FilterTask task = running.front();
+      running.pop_front();
 
-      buffer = buffer.mid(3);
-      fileContents  = QString::fromUtf8(buffer);
+      QByteArray buffer;
 
-   } else {
-      // transcode according to the INPUT_ENCODING setting
-      // do character transcoding if needed
+      if (finishInputFilter(*task.process, task.cmd, buffer)) {
+         filterCache().insert(task.key, new QByteArray(buffer), buffer.size());
+      }
 
-      fileContents = transcodeToQString(buffer);
-   }
+      delete task.process;
+   };
 
-   // translate CR's
-   fileContents = filterCRLF(fileContents);
+   for (const auto &fileName : fileNames) {
+      QString filterName = getFileFilter(fileName, isSourceCode);
 
-   return true;
+      if (filterName.isEmpty()) {
+         continue;
+      }
+
+      QString cmd = filterName + " \"" + fileName + "\"";
+      QString key = filterCacheKey(cmd, fileName);
+
+      if (key.isEmpty() || started.contains(key) || filterCache().contains(key)) {
+         continue;
+      }
+
+      if (static_cast<int>(running.size()) >= maxTasks) {
+         finishOldest();
+      }
+
+      started.insert(key);
+
+      QProcess *process = new QProcess;
+      process->start(cmd);
+
+      running.push_back(FilterTask{cmd, key, process});
+   }
+
+   while (! running.empty()) {
+      finishOldest();
+   }
 }
 
 // Replace %word by word in title
@@ -7511,25 +7804,59 @@ QString filterTitle(const QString &title)
    return retval;
 }
 
-// returns true if the name of the file represented by `fi' matches
-// one of the file patterns in the `patList' list
+// converts a wildcard pattern to a regular expression, * and ? match any character including a slash
+static QString wildcardToRegExp(const QString &pattern)
+{
+   static const QString specialChars = "\\.^$|()+{}";
 
-bool patternMatch(const QFileInfo &fi, const QStringList &patList)
+   QString retval;
+   bool inSet = false;
+
+   for (QChar c : pattern) {
+
+      if (inSet) {
+         if (c == ']') {
+            inSet = false;
+         }
+
+         retval += c;
+
+      } else if (c == '*') {
+         retval += ".*";
+
+      } else if (c == '?') {
+         retval += '.';
+
+      } else if (c == '[') {
+         inSet = true;
+         retval += c;
+
+      } else if (specialChars.contains(c) || c == ']') {
+         retval += '\\';
+         retval += c;
+
+      } else {
+         retval += c;
+      }
+   }
+
+   return retval;
+}
+
+// all patterns in a list are combined into one regular expression, compiled once per list
+static const QRegularExpression &compiledPatternList(const QStringList &patList, Qt::CaseSensitivity ignoreCase)
 {
-   static Qt::CaseSensitivity ignoreCase = Config::getCase("case-sensitive-fname");
+   static QHash<QString, QRegularExpression> cache;
 
-   // For Windows and Mac OS X always do the case insensitive match
-#if defined(_WIN32) || defined(__MACOSX__)
-   ignoreCase = Qt::CaseInsensitive;
-#endif
+   const QString key = patList.join('\n');
 
-   bool found = false;
+   auto iter = cache.find(key);
 
-   QString fn  = fi.fileName();
-   QString fp  = fi.filePath();
-   QString afp = fi.absoluteFilePath();
+   if (iter != cache.end()) {
+      return iter.value();
+   }
 
-   QRegularExpression regExp;
+   QString combined;
 
    for (auto pattern : patList) {
 
@@ -7540,29 +7867,57 @@ bool patternMatch(const QFileInfo &fi, const QStringList &patList)
             pattern = pattern.left(i);   // strip off the extension
          }
 
-         if (ignoreCase == Qt::CaseInsensitive) {
-            regExp = QRegularExpression(pattern, QPatternOption::CaseInsensitiveOption | QPatternOption::WildcardOption |
-                  QPatternOption::ExactMatchOption);
-
-         } else  {
-            regExp = QRegularExpression(pattern, QPatternOption::WildcardOption | QPatternOption::ExactMatchOption);
-
+         if (! combined.isEmpty()) {
+            combined += '|';
          }
 
-         // input-patterns
-         // possilbe issue if the pattern has something other than a wildcard for the name
-         // found = re.indexIn(fn) != -1 || re.indexIn(fp) != -1 || re.indexIn(afp) != -1;
+         combined += "(?:" + wildcardToRegExp(pattern) + ")";
+      }
+   }
 
-         found = fn.contains(regExp) || fp.contains(regExp) || afp.contains(regExp);
+   QRegularExpression regExp;
 
-         if (found) {
-            break;
-         }
+   if (! combined.isEmpty()) {
+      combined = "^(?:" + combined + ")$";
+
+      if (ignoreCase == Qt::CaseInsensitive) {
+         regExp = QRegularExpression(combined, QPatternOption::CaseInsensitiveOption);
+      } else {
+         regExp = QRegularExpression(combined);
       }
+   }
 
+   return cache.insert(key, regExp).value();
+}
+
+// returns true if the name of the file represented by `fi' matches
+// one of the file patterns in the `patList' list
+
+bool patternMatch(const QFileInfo &fi, const QStringList &patList)
+{
+   static Qt::CaseSensitivity ignoreCase = Config::getCase("case-sensitive-fname");
+
+   // For Windows and Mac OS X always do the case insensitive match
+#if defined(_WIN32) || defined(__MACOSX__)
+   ignoreCase = Qt::CaseInsensitive;
+#endif
+
+   if (patList.isEmpty()) {
+      return false;
+   }
+
+   const QRegularExpression &regExp = compiledPatternList(patList, ignoreCase);
+
+   if (regExp.pattern().isEmpty()) {
+      // no patterns in the list
+      return false;
    }
 
-   return found;
+   // input-patterns
+   // possilbe issue if the pattern has something other than a wildcard for the name
+
+   return regExp.match(fi.fileName()).hasMatch() || regExp.match(fi.filePath()).hasMatch() ||
+          regExp.match(fi.absoluteFilePath()).hasMatch();
 }
 
 QString externalLinkTarget()
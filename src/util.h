@@ -136,6 +136,7 @@ void    addRefItem(const QVector<ListItemInfo> &list, const QString &key, const
                   const QString &name, const QString &title, const QString &args, QSharedPointer<Definition> scope);
 
 QString argListToString(const ArgumentList &al, bool useCanonicalType = false, bool showDefVals = true);
+void    buildMemberSignatureIndex();
 
 QChar   charToLower(const QString &s, int index);
 QChar   charToUpper(const QString &s, int index);
@@ -194,8 +195,8 @@ QByteArray getCanonicalTemplateSpec(QSharedPointer<Definition> d, QSharedPointer
 
 bool    hasVisibleRoot(SortedList<BaseClassDef *> *bcl);
 
-int     isAccessibleFrom(QSharedPointer<const Definition> scope, QSharedPointer<const FileDef> fileScope,
-                  QSharedPointer<const Definition> item);
+int     isAccessibleFrom(const QSharedPointer<const Definition> &scope, const QSharedPointer<const FileDef> &fileScope,
+                  const QSharedPointer<const Definition> &item);
 
 void    initClassHierarchy(ClassSDict *cl);
 
@@ -235,6 +236,7 @@ QString parseCommentAsText(QSharedPointer<const Definition> scope, QSharedPointe
 
 QString readInputFile(const QString &fileName);
 bool    readInputFile(const QString &fileName, QString &fileContents, bool filter = true, bool isSourceCode = false);
+void    prefetchInputFilters(const QStringList &fileNames, bool isSourceCode = false);
 
 QString resolveAliasCmd(const QString &aliasCmd);
 QString removeRedundantWhiteSpace(const QString &s, bool makePretty = true);